@@ -0,0 +1,98 @@
+package benchmarks
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/miretskiy/firn/polars"
+)
+
+// chainLengths are the op-chain lengths used to fit the per-operation dispatch cost
+var chainLengths = []int{1, 2, 4, 8, 16, 32}
+
+// collected returns a small executed DataFrame so benchmarks measure dispatch, not I/O
+func collected(b *testing.B, path string) *polars.DataFrame {
+	b.Helper()
+
+	df, err := polars.ReadCSV(path).Collect()
+	if err != nil {
+		b.Fatal(err)
+	}
+	b.Cleanup(func() { df.Release() })
+	return df
+}
+
+// BenchmarkNoopCGO measures the floor cost of a single Go -> Rust call
+func BenchmarkNoopCGO(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		polars.NoopCGOCall()
+	}
+}
+
+// BenchmarkOpChain measures decode + dispatch cost in execute_operations as the
+// chain grows. Limit on an executed DataFrame is a zero-copy head(), so the slope
+// across chain lengths is the per-operation overhead.
+func BenchmarkOpChain(b *testing.B) {
+	base := collected(b, "datasets/iris.csv")
+
+	for _, n := range chainLengths {
+		b.Run(fmt.Sprintf("ops=%d", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				shared, err := base.Share()
+				if err != nil {
+					b.Fatal(err)
+				}
+				for range n {
+					shared = shared.Limit(100)
+				}
+				result, err := shared.Collect()
+				if err != nil {
+					b.Fatal(err)
+				}
+				result.Release()
+			}
+		})
+	}
+}
+
+// buildExpr builds a left-deep arithmetic expression with n binary operations
+func buildExpr(n int) *polars.ExprNode {
+	expr := polars.Col("sepal.length")
+	for i := range n {
+		expr = expr.Add(polars.Lit(i))
+	}
+	return expr.Alias("result")
+}
+
+// BenchmarkExprBuild measures Go-side expression construction (no CGO)
+func BenchmarkExprBuild(b *testing.B) {
+	for _, n := range chainLengths {
+		b.Run(fmt.Sprintf("nodes=%d", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				_ = buildExpr(n)
+			}
+		})
+	}
+}
+
+// BenchmarkExprStack measures building the expression on the Rust RPN stack and
+// evaluating it over 150 rows, so the cost is dominated by per-node decode
+func BenchmarkExprStack(b *testing.B) {
+	base := collected(b, "datasets/iris.csv")
+
+	for _, n := range chainLengths {
+		b.Run(fmt.Sprintf("nodes=%d", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				shared, err := base.Share()
+				if err != nil {
+					b.Fatal(err)
+				}
+				result, err := shared.SelectExpr(buildExpr(n)).Collect()
+				if err != nil {
+					b.Fatal(err)
+				}
+				result.Release()
+			}
+		})
+	}
+}
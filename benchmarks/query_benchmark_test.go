@@ -0,0 +1,110 @@
+package benchmarks
+
+import (
+	"testing"
+
+	"github.com/miretskiy/firn/polars"
+	"github.com/stretchr/testify/require"
+)
+
+// query is an end-to-end pipeline: scan, transform and collect
+type query struct {
+	name  string
+	build func() *polars.DataFrame
+	rows  int // Expected result height, checked by TestQueries
+}
+
+var queries = []query{
+	{
+		name: "IrisGroupByMean",
+		build: func() *polars.DataFrame {
+			return polars.ReadCSV("datasets/iris.csv").
+				GroupBy("variety").
+				Agg(polars.Col("sepal.length").Mean().Alias("mean_sepal_length"))
+		},
+		rows: 3,
+	},
+	{
+		name: "TipsFilterWithColumns",
+		build: func() *polars.DataFrame {
+			return polars.ReadCSV("datasets/tips.csv").
+				Filter(polars.Col("time").Eq(polars.Lit("Dinner"))).
+				WithColumns(polars.Col("tip").Div(polars.Col("total_bill")).Alias("tip_pct")).
+				Select("day", "tip_pct")
+		},
+		rows: 176,
+	},
+	{
+		name: "TitanicSurvivalBySex",
+		build: func() *polars.DataFrame {
+			return polars.ReadCSV("datasets/titanic.csv").
+				Filter(polars.Col("Age").IsNotNull()).
+				GroupBy("Sex", "Pclass").
+				Agg(
+					polars.Col("Survived").Mean().Alias("survival_rate"),
+					polars.Col("Fare").Median().Alias("median_fare"),
+				)
+		},
+		rows: 6,
+	},
+	{
+		name: "FlightsTopMonths",
+		build: func() *polars.DataFrame {
+			return polars.ReadCSV("datasets/flights.csv").
+				SortBy([]polars.SortField{polars.Desc("passengers")}).
+				Limit(10)
+		},
+		rows: 10,
+	},
+	{
+		name: "FortuneSectorCounts",
+		build: func() *polars.DataFrame {
+			return polars.ReadParquet("../testdata/fortune1000_2024.parquet").
+				GroupBy("Sector").
+				Agg(polars.Col("Company").Count().Alias("companies")).
+				SortBy([]polars.SortField{polars.Desc("companies")}).
+				Limit(5)
+		},
+		rows: 5,
+	},
+	{
+		name: "FortuneTop10",
+		build: func() *polars.DataFrame {
+			return polars.ReadParquet("../testdata/fortune1000_2024.parquet").
+				Select("Rank", "Company", "Sector").
+				Filter(polars.Col("Rank").Lt(polars.Lit(11)))
+		},
+		rows: 10,
+	},
+}
+
+// TestQueries checks every benchmarked pipeline still runs and returns the expected
+// shape, so a regression in results is not mistaken for a speedup
+func TestQueries(t *testing.T) {
+	for _, q := range queries {
+		t.Run(q.name, func(t *testing.T) {
+			result, err := q.build().Collect()
+			require.NoError(t, err)
+			defer result.Release()
+
+			height, err := result.Height()
+			require.NoError(t, err)
+			require.Equal(t, q.rows, height)
+		})
+	}
+}
+
+// BenchmarkQuery runs each pipeline end to end, including file scan and release
+func BenchmarkQuery(b *testing.B) {
+	for _, q := range queries {
+		b.Run(q.name, func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				result, err := q.build().Collect()
+				if err != nil {
+					b.Fatal(err)
+				}
+				result.Release()
+			}
+		})
+	}
+}
@@ -18,10 +18,26 @@ func main() {
 	fmt.Printf("🔍 Inspecting Parquet file: %s\n", parquetFile)
 	fmt.Println("================================================================================")
 	
-	// Read just the first few rows to inspect schema
-	fmt.Println("📊 Reading sample data to inspect schema...")
+	// Resolve the schema from the file metadata - no rows are read
+	fmt.Println("🧬 Resolving schema...")
 	start := time.Now()
 	
+	scan := polars.ReadParquet(parquetFile)
+	schema, err := scan.Schema()
+	if err != nil {
+		log.Fatalf("Error resolving schema: %v", err)
+	}
+	scan.Release()
+	fmt.Printf("⏱️  Schema resolved in: %v\n", time.Since(start))
+	for _, column := range schema {
+		fmt.Printf("  %-40s 0x%08x\n", column.Name, uint32(column.Type))
+	}
+	fmt.Println()
+	
+	// Read just the first few rows to inspect the data
+	fmt.Println("📊 Reading sample data...")
+	start = time.Now()
+	
 	df := polars.ReadParquetWithOptions(parquetFile, polars.ParquetOptions{
 		NRows:    10, // Just read first 10 rows for schema inspection
 		Parallel: true,
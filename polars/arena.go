@@ -0,0 +1,104 @@
+package polars
+
+/*
+#include <stdlib.h>
+#include "firn.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// Size of the first arena chunk; most operation chains fit in it entirely
+const arenaChunkSize = 8 << 10
+
+// argArena bump-allocates the C representation of one execution's operation args
+// Arg structs, string bytes and nested arrays are copied into a few contiguous
+// C buffers (usually one), so building the op stream costs O(1) allocations, the
+// Go GC never sees pointers into it, and Rust reads the args from adjacent memory.
+// Everything is released in a single free() once the Rust call returns.
+type argArena struct {
+	chunks []unsafe.Pointer // C buffers owned by the arena
+	chunk  unsafe.Pointer   // Current chunk (calloc memory is aligned for any C type)
+	off    uintptr          // Next free byte in the current chunk
+	size   uintptr          // Size of the current chunk
+
+	handles []C.uintptr_t // Frames built for this execution (see Operation.prepare)
+}
+
+// alloc returns size bytes aligned to align, zeroed, valid until free
+func (a *argArena) alloc(size, align uintptr) unsafe.Pointer {
+	off := (a.off + align - 1) &^ (align - 1)
+	if a.chunk == nil || off+size > a.size {
+		chunkSize := uintptr(arenaChunkSize) << len(a.chunks) // Grow geometrically
+		for chunkSize < size {
+			chunkSize *= 2
+		}
+		chunk := C.calloc(1, C.size_t(chunkSize))
+		if chunk == nil {
+			panic("polars: out of memory allocating operation args")
+		}
+		a.chunks = append(a.chunks, chunk)
+		a.chunk, a.size, off = chunk, chunkSize, 0
+	}
+	a.off = off + size
+	return unsafe.Add(a.chunk, off)
+}
+
+// own hands a frame handle to the arena, released by free once the call returns
+func (a *argArena) own(handle C.uintptr_t) {
+	a.handles = append(a.handles, handle)
+}
+
+// free releases every chunk and owned handle; pointers handed out by the arena become invalid
+func (a *argArena) free() {
+	for _, chunk := range a.chunks {
+		C.free(chunk)
+	}
+	for _, handle := range a.handles {
+		C.release_dataframe(handle)
+	}
+	a.chunks = a.chunks[:0]
+	a.handles = a.handles[:0]
+	a.chunk, a.off, a.size = nil, 0, 0
+}
+
+// rawStr copies s into the arena
+func (a *argArena) rawStr(s string) C.RawStr {
+	if len(s) == 0 {
+		return C.RawStr{data: nil, len: 0}
+	}
+	data := a.alloc(uintptr(len(s)), 1)
+	copy(unsafe.Slice((*byte)(data), len(s)), s)
+	return C.RawStr{data: (*C.char)(data), len: C.size_t(len(s))}
+}
+
+// rawStrs copies a list of strings into a RawStr array in the arena (nil if empty)
+func (a *argArena) rawStrs(values []string) *C.RawStr {
+	if len(values) == 0 {
+		return nil
+	}
+	strs := arenaSlice[C.RawStr](a, len(values))
+	for i, value := range values {
+		strs[i] = a.rawStr(value)
+	}
+	return &strs[0]
+}
+
+// arenaNew copies v into the arena and returns a pointer to the copy
+// v must not contain Go pointers - only C values and pointers into the arena.
+func arenaNew[T any](a *argArena, v T) unsafe.Pointer {
+	p := (*T)(a.alloc(unsafe.Sizeof(v), unsafe.Alignof(v)))
+	*p = v
+	return unsafe.Pointer(p)
+}
+
+// arenaSlice allocates a zeroed array of n elements in the arena
+func arenaSlice[T any](a *argArena, n int) []T {
+	if n == 0 {
+		return nil
+	}
+	var zero T
+	data := a.alloc(unsafe.Sizeof(zero)*uintptr(n), unsafe.Alignof(zero))
+	return unsafe.Slice((*T)(data), n)
+}
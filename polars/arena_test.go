@@ -0,0 +1,64 @@
+package polars
+
+import (
+	"fmt"
+	"testing"
+	"unsafe"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestArgArena verifies bump allocation of operation args into C memory
+func TestArgArena(t *testing.T) {
+	t.Run("AlignmentAndZeroing", func(t *testing.T) {
+		arena := &argArena{}
+		defer arena.free()
+
+		arena.alloc(3, 1)
+		values := arenaSlice[int64](arena, 4)
+		require.Len(t, values, 4)
+		require.Zero(t, uintptr(unsafe.Pointer(&values[0]))%unsafe.Alignof(values[0]))
+		require.Equal(t, []int64{0, 0, 0, 0}, values)
+		require.Nil(t, arenaSlice[int64](arena, 0))
+	})
+
+	t.Run("GrowsPastFirstChunk", func(t *testing.T) {
+		arena := &argArena{}
+		defer arena.free()
+
+		small := arenaSlice[byte](arena, 16)
+		large := arenaSlice[byte](arena, 3*arenaChunkSize)
+		require.Len(t, arena.chunks, 2)
+		large[len(large)-1] = 1 // Whole allocation is addressable
+		small[0] = 2
+		require.Equal(t, byte(1), large[len(large)-1])
+	})
+
+	t.Run("CopiesStrings", func(t *testing.T) {
+		arena := &argArena{}
+		defer arena.free()
+
+		name := fmt.Sprintf("column_%d", 42)
+		raw := arena.rawStr(name)
+		require.NotEqual(t, unsafe.Pointer(unsafe.StringData(name)), unsafe.Pointer(raw.data))
+		require.Equal(t, name, unsafe.String((*byte)(unsafe.Pointer(raw.data)), int(raw.len)))
+		require.Nil(t, arena.rawStrs(nil))
+	})
+
+	t.Run("LargeChain", func(t *testing.T) {
+		// Enough expressions to spill the op stream over several arena chunks
+		exprs := make([]any, 0, 500)
+		for i := 0; i < 500; i++ {
+			exprs = append(exprs, Col("salary").Mul(Lit(i)).Alias(fmt.Sprintf("salary_x_%03d_with_a_long_name", i)))
+		}
+
+		df, err := ReadCSV("../testdata/sample.csv").Select(exprs...).Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		batch, err := df.ToArrow()
+		require.NoError(t, err)
+		defer batch.Release()
+		require.Equal(t, 500, batch.NumColumns())
+	})
+}
@@ -0,0 +1,264 @@
+package polars
+
+/*
+#include "firn.h"
+
+// cgo cannot call C function pointers directly, so release callbacks go through these helpers
+static void firn_release_arrow_array(struct ArrowArray* array) {
+	if (array != NULL && array->release != NULL) {
+		array->release(array);
+	}
+}
+
+static void firn_release_arrow_schema(struct ArrowSchema* schema) {
+	if (schema != NULL && schema->release != NULL) {
+		schema->release(schema);
+	}
+}
+*/
+import "C"
+import (
+	"errors"
+	"fmt"
+	"unsafe"
+)
+
+// ArrowBatch is a zero-copy view of a collected DataFrame exported through the
+// Arrow C Data Interface. The batch is a struct array with one child per column.
+// Buffers stay owned by Rust and remain valid until Release is called, even if
+// the originating DataFrame is released first.
+type ArrowBatch struct {
+	array  *C.struct_ArrowArray
+	schema *C.struct_ArrowSchema
+}
+
+// ArrowColumn is a borrowed view of a single column in an ArrowBatch
+type ArrowColumn struct {
+	array  *C.struct_ArrowArray
+	schema *C.struct_ArrowSchema
+}
+
+// ToArrow exports a collected DataFrame as Arrow arrays without copying column data
+// The returned batch must be released with Release() once the data is no longer needed
+func (df *DataFrame) ToArrow() (*ArrowBatch, error) {
+	if df.handle.handle == 0 {
+		return nil, errors.New("dataframe not executed - call Collect() first")
+	}
+	if df.handle.context_type != contextDataFrame {
+		return nil, errors.New("ToArrow() requires a collected DataFrame - call Collect() first")
+	}
+
+	array := (*C.struct_ArrowArray)(C.calloc(1, C.sizeof_struct_ArrowArray))
+	schema := (*C.struct_ArrowSchema)(C.calloc(1, C.sizeof_struct_ArrowSchema))
+
+	if rc := C.dataframe_to_arrow(df.handle.handle, array, schema); rc != 0 {
+		C.free(unsafe.Pointer(array))
+		C.free(unsafe.Pointer(schema))
+		return nil, &Error{
+			Code:    int(rc),
+			Message: "failed to export dataframe to Arrow",
+		}
+	}
+
+	return &ArrowBatch{array: array, schema: schema}, nil
+}
+
+// FromArrow creates a DataFrame that references an existing Arrow struct array
+// array and schema must point to C `struct ArrowArray` / `struct ArrowSchema` values
+// (e.g. from arrow-go's cdata.ExportArrowRecordBatch). The array is moved into the
+// DataFrame on execution, so the caller must not release it afterwards; the schema
+// is only borrowed and remains owned by the caller.
+func FromArrow(array, schema unsafe.Pointer) *DataFrame {
+	if array == nil || schema == nil {
+		return &DataFrame{operations: []Operation{errOp("FromArrow: array and schema cannot be nil")}}
+	}
+
+	op := Operation{
+		opcode: OpImportArrow,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.ImportArrowArgs{
+				array:  (*C.struct_ArrowArray)(array),
+				schema: (*C.struct_ArrowSchema)(schema),
+			})
+		},
+	}
+
+	return &DataFrame{
+		handle:     C.PolarsHandle{handle: C.uintptr_t(0), context_type: C.uint32_t(0)}, // Lazy - no handle yet
+		operations: []Operation{op},
+	}
+}
+
+// FromArrowStream creates a DataFrame from a C `struct ArrowArrayStream`
+// Each batch in the stream becomes one chunk of the DataFrame; the stream is moved on execution
+func FromArrowStream(stream unsafe.Pointer) *DataFrame {
+	if stream == nil {
+		return &DataFrame{operations: []Operation{errOp("FromArrowStream: stream cannot be nil")}}
+	}
+
+	op := Operation{
+		opcode: OpImportArrow,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.ImportArrowArgs{
+				stream: (*C.struct_ArrowArrayStream)(stream),
+			})
+		},
+	}
+
+	return &DataFrame{
+		handle:     C.PolarsHandle{handle: C.uintptr_t(0), context_type: C.uint32_t(0)}, // Lazy - no handle yet
+		operations: []Operation{op},
+	}
+}
+
+// NumRows returns the number of rows in the batch
+func (b *ArrowBatch) NumRows() int {
+	if b.array == nil {
+		return 0
+	}
+	return int(b.array.length)
+}
+
+// NumColumns returns the number of columns in the batch
+func (b *ArrowBatch) NumColumns() int {
+	if b.array == nil {
+		return 0
+	}
+	return int(b.array.n_children)
+}
+
+// Column returns a borrowed view of the i-th column
+func (b *ArrowBatch) Column(i int) ArrowColumn {
+	if i < 0 || i >= b.NumColumns() {
+		panic(fmt.Sprintf("arrow column index %d out of range [0, %d)", i, b.NumColumns()))
+	}
+	arrays := unsafe.Slice(b.array.children, b.array.n_children)
+	schemas := unsafe.Slice(b.schema.children, b.schema.n_children)
+	return ArrowColumn{array: arrays[i], schema: schemas[i]}
+}
+
+// ColumnByName returns the column with the given name, if present
+func (b *ArrowBatch) ColumnByName(name string) (ArrowColumn, bool) {
+	for i := 0; i < b.NumColumns(); i++ {
+		column := b.Column(i)
+		if column.Name() == name {
+			return column, true
+		}
+	}
+	return ArrowColumn{}, false
+}
+
+// CArrowArray returns the underlying *struct ArrowArray for use with other Arrow
+// libraries (e.g. arrow-go's cdata.ImportCRecordBatch). A consumer that moves the
+// array takes over its release; calling Release afterwards is still safe.
+func (b *ArrowBatch) CArrowArray() unsafe.Pointer {
+	return unsafe.Pointer(b.array)
+}
+
+// CArrowSchema returns the underlying *struct ArrowSchema for use with other Arrow libraries
+func (b *ArrowBatch) CArrowSchema() unsafe.Pointer {
+	return unsafe.Pointer(b.schema)
+}
+
+// Release invokes the Arrow release callbacks, returning the buffers to Rust
+func (b *ArrowBatch) Release() {
+	if b.array != nil {
+		C.firn_release_arrow_array(b.array)
+		C.free(unsafe.Pointer(b.array))
+		b.array = nil
+	}
+	if b.schema != nil {
+		C.firn_release_arrow_schema(b.schema)
+		C.free(unsafe.Pointer(b.schema))
+		b.schema = nil
+	}
+}
+
+// Name returns the column name
+func (c ArrowColumn) Name() string {
+	return C.GoString(c.schema.name)
+}
+
+// Format returns the Arrow format string (e.g. "l" for int64, "vu" for string view)
+func (c ArrowColumn) Format() string {
+	return C.GoString(c.schema.format)
+}
+
+// Len returns the number of values in the column
+func (c ArrowColumn) Len() int {
+	return int(c.array.length)
+}
+
+// NullCount returns the number of null values in the column
+func (c ArrowColumn) NullCount() int {
+	return int(c.array.null_count)
+}
+
+// Offset returns the logical offset into the column buffers
+func (c ArrowColumn) Offset() int {
+	return int(c.array.offset)
+}
+
+// Buffer returns the raw pointer to the i-th buffer (nil for an absent validity bitmap)
+func (c ArrowColumn) Buffer(i int) unsafe.Pointer {
+	if i < 0 || i >= int(c.array.n_buffers) {
+		return nil
+	}
+	buffers := unsafe.Slice(c.array.buffers, c.array.n_buffers)
+	return unsafe.Pointer(buffers[i])
+}
+
+// IsValid reports whether the value at row i is non-null
+func (c ArrowColumn) IsValid(i int) bool {
+	validity := c.Buffer(0)
+	if validity == nil || c.NullCount() == 0 {
+		return true
+	}
+	bit := c.Offset() + i
+	bitmap := unsafe.Slice((*byte)(validity), bit/8+1)
+	return bitmap[bit/8]&(1<<(bit%8)) != 0
+}
+
+// ArrowNumeric constrains the fixed-width types readable through ArrowValues
+type ArrowNumeric interface {
+	int8 | int16 | int32 | int64 | uint8 | uint16 | uint32 | uint64 | float32 | float64
+}
+
+// ArrowValues returns a zero-copy slice over a fixed-width column's value buffer
+// The slice aliases Rust-owned memory and is only valid until the batch is released
+func ArrowValues[T ArrowNumeric](c ArrowColumn) ([]T, error) {
+	var zero T
+	var want string
+	switch any(zero).(type) {
+	case int8:
+		want = "c"
+	case uint8:
+		want = "C"
+	case int16:
+		want = "s"
+	case uint16:
+		want = "S"
+	case int32:
+		want = "i"
+	case uint32:
+		want = "I"
+	case int64:
+		want = "l"
+	case uint64:
+		want = "L"
+	case float32:
+		want = "f"
+	case float64:
+		want = "g"
+	}
+
+	if format := c.Format(); format != want {
+		return nil, fmt.Errorf("column %q has Arrow format %q, expected %q", c.Name(), format, want)
+	}
+	if c.Len() == 0 {
+		return []T{}, nil
+	}
+
+	values := unsafe.Slice((*T)(c.Buffer(1)), c.Offset()+c.Len())
+	return values[c.Offset():], nil
+}
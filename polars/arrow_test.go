@@ -0,0 +1,106 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestArrowExport verifies zero-copy export through the Arrow C Data Interface
+func TestArrowExport(t *testing.T) {
+	t.Run("SchemaAndValues", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		result, err := df.Select("name", "age").Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		batch, err := result.ToArrow()
+		require.NoError(t, err)
+		defer batch.Release()
+
+		require.Equal(t, 7, batch.NumRows())
+		require.Equal(t, 2, batch.NumColumns())
+		require.Equal(t, "name", batch.Column(0).Name())
+		require.Equal(t, "age", batch.Column(1).Name())
+
+		ages, err := ArrowValues[int64](batch.Column(1))
+		require.NoError(t, err)
+		require.Equal(t, []int64{25, 30, 35, 28, 32, 29, 27}, ages)
+	})
+
+	t.Run("BatchOutlivesDataFrame", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		result, err := df.Select("salary").Collect()
+		require.NoError(t, err)
+
+		batch, err := result.ToArrow()
+		require.NoError(t, err)
+		defer batch.Release()
+
+		// Buffers are reference counted on the Rust side, so the handle can go first
+		require.NoError(t, result.Release())
+
+		salary, ok := batch.ColumnByName("salary")
+		require.True(t, ok)
+		values, err := ArrowValues[int64](salary)
+		require.NoError(t, err)
+		require.Equal(t, int64(50000), values[0])
+		require.True(t, salary.IsValid(0))
+	})
+
+	t.Run("FormatMismatch", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		result, err := df.Select("age").Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		batch, err := result.ToArrow()
+		require.NoError(t, err)
+		defer batch.Release()
+
+		_, err = ArrowValues[float64](batch.Column(0))
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "expected \"g\"")
+	})
+
+	t.Run("RoundTrip", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		source, err := df.Select("name", "age").Collect()
+		require.NoError(t, err)
+		defer source.Release()
+
+		batch, err := source.ToArrow()
+		require.NoError(t, err)
+		defer batch.Release() // Safe after the array was moved into the DataFrame
+
+		imported, err := FromArrow(batch.CArrowArray(), batch.CArrowSchema()).
+			Filter(Col("age").Gt(Lit(30))).
+			Collect()
+		require.NoError(t, err)
+		defer imported.Release()
+
+		expected := `shape: (2, 2)
+┌─────────┬─────┐
+│ name    ┆ age │
+│ ---     ┆ --- │
+│ str     ┆ i64 │
+╞═════════╪═════╡
+│ Charlie ┆ 35  │
+│ Eve     ┆ 32  │
+└─────────┴─────┘`
+
+		require.Equal(t, expected, imported.String())
+	})
+
+	t.Run("FromArrowNil", func(t *testing.T) {
+		_, err := FromArrow(nil, nil).Collect()
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "array and schema cannot be nil")
+	})
+
+	t.Run("NotCollected", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		_, err := df.ToArrow()
+		require.Error(t, err)
+	})
+}
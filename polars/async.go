@@ -0,0 +1,110 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"context"
+	"errors"
+	"time"
+)
+
+// Poll interval bounds for CollectAsync - short queries are picked up quickly,
+// long ones cost at most one cheap CGO call per maxPollInterval
+const (
+	minPollInterval = 50 * time.Microsecond
+	maxPollInterval = 10 * time.Millisecond
+)
+
+// CollectResult is delivered by CollectAsync once the query has finished
+type CollectResult struct {
+	DataFrame *DataFrame // Collected result (nil on error)
+	Err       error
+}
+
+// CollectAsync submits the pending operations and collects them in the background
+// The query runs on the Polars thread pool, so no goroutine sits in a blocking CGO
+// call (and no OS thread is parked) while it executes. The channel receives exactly
+// one result. Cancelling ctx stops the Polars query early and delivers ctx.Err().
+//
+// The pending operations are consumed at submission; this DataFrame keeps its
+// current handle and the result is returned as a new DataFrame.
+func (df *DataFrame) CollectAsync(ctx context.Context) <-chan CollectResult {
+	results := make(chan CollectResult, 1)
+
+	if err := ctx.Err(); err != nil {
+		df.operations = df.operations[:0]
+		results <- CollectResult{Err: err}
+		return results
+	}
+
+	ticket, err := df.submit()
+	if err != nil {
+		results <- CollectResult{Err: err}
+		return results
+	}
+
+	go func() {
+		result := awaitQuery(ctx, ticket)
+		results <- result // Deliver before releasing: a cancelled query may take a moment to stop
+		C.release_query(ticket)
+	}()
+	return results
+}
+
+// submit decodes the pending operations on the Rust side and starts the query
+func (df *DataFrame) submit() (C.uintptr_t, error) {
+	if df.handle.handle == 0 && len(df.operations) == 0 {
+		return 0, errors.New("no operations to execute")
+	}
+
+	defer func() {
+		df.operations = df.operations[:0]
+	}()
+
+	var result C.FfiResult
+	if len(df.operations) == 0 {
+		result = C.submit_query(df.handle, nil, 0) // Already executed - collect as-is
+	} else {
+		arena := &argArena{}
+		defer arena.free() // Rust decodes the ops before submit_query returns
+		cOps, err := df.buildOperations(arena)
+		if err != nil {
+			return 0, err
+		}
+		result = C.submit_query(df.handle, &cOps[0], C.size_t(len(cOps)))
+	}
+
+	if err := resultError(result); err != nil {
+		return 0, err
+	}
+	return result.polars_handle.handle, nil
+}
+
+// awaitQuery polls a submitted query with exponential backoff until it finishes
+// or ctx is done
+func awaitQuery(ctx context.Context, ticket C.uintptr_t) CollectResult {
+	interval := minPollInterval
+	timer := time.NewTimer(interval)
+	defer timer.Stop()
+
+	var result C.FfiResult
+	for !C.poll_query(ticket, &result) {
+		select {
+		case <-ctx.Done():
+			// Polars stops at the next operator boundary; release_query waits for
+			// that and discards whatever the query produced
+			C.cancel_query(ticket)
+			return CollectResult{Err: ctx.Err()}
+		case <-timer.C:
+			interval = min(interval*2, maxPollInterval)
+			timer.Reset(interval)
+		}
+	}
+
+	if err := resultError(result); err != nil {
+		return CollectResult{Err: err}
+	}
+	return CollectResult{DataFrame: &DataFrame{handle: result.polars_handle}}
+}
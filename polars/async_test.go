@@ -0,0 +1,62 @@
+package polars
+
+import (
+	"context"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestCollectAsync verifies queries can be collected in the background
+func TestCollectAsync(t *testing.T) {
+	t.Run("Result", func(t *testing.T) {
+		result := <-ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Sales"))).
+			Select("name", "age").
+			CollectAsync(context.Background())
+		require.NoError(t, result.Err)
+		defer result.DataFrame.Release()
+
+		expected := `shape: (2, 2)
+┌───────┬─────┐
+│ name  ┆ age │
+│ ---   ┆ --- │
+│ str   ┆ i64 │
+╞═══════╪═════╡
+│ Diana ┆ 28  │
+│ Grace ┆ 27  │
+└───────┴─────┘`
+		require.Equal(t, expected, result.DataFrame.String())
+	})
+
+	t.Run("Concurrent", func(t *testing.T) {
+		channels := make([]<-chan CollectResult, 8)
+		for i := range channels {
+			channels[i] = ReadCSV("../testdata/sample.csv").Limit(i + 1).CollectAsync(context.Background())
+		}
+
+		for i, ch := range channels {
+			result := <-ch
+			require.NoError(t, result.Err)
+			height, err := result.DataFrame.Height()
+			require.NoError(t, err)
+			require.Equal(t, i+1, height)
+			require.NoError(t, result.DataFrame.Release())
+		}
+	})
+
+	t.Run("CancelledContext", func(t *testing.T) {
+		ctx, cancel := context.WithCancel(context.Background())
+		cancel()
+
+		result := <-ReadCSV("../testdata/sample.csv").CollectAsync(ctx)
+		require.ErrorIs(t, result.Err, context.Canceled)
+		require.Nil(t, result.DataFrame)
+	})
+
+	t.Run("SubmitError", func(t *testing.T) {
+		result := <-ReadCSV("../testdata/sample.csv").GroupBy("department").CollectAsync(context.Background())
+		require.Error(t, result.Err)
+		require.Contains(t, result.Err.Error(), "Call agg() first")
+	})
+}
@@ -0,0 +1,80 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"fmt"
+)
+
+// CollectAll materializes several independent pipelines with a single CGO call
+// The plans are built one after another, then collected concurrently on the
+// Polars thread pool. Each DataFrame is updated in place, as with Collect, and
+// returned in the same order. A failing pipeline does not stop the others: the
+// returned error joins every failure, tagged with the index of its DataFrame.
+func CollectAll(dfs ...*DataFrame) ([]*DataFrame, error) {
+	if len(dfs) == 0 {
+		return dfs, nil
+	}
+
+	arena := &argArena{} // Shared by every pipeline; freed once execute_batch returns
+	defer arena.free()
+
+	errs := make([]error, len(dfs))
+	plans := make([]C.PlanDesc, 0, len(dfs))
+	indices := make([]int, 0, len(dfs)) // dfs index of each plan
+
+	for i, df := range dfs {
+		if df.handle.handle == 0 && len(df.operations) == 0 {
+			errs[i] = errors.New("no operations to execute")
+			continue
+		}
+
+		cOps, err := df.buildOperations(arena)
+		df.operations = df.operations[:0]
+		if err != nil {
+			errs[i] = err
+			continue
+		}
+
+		plan := C.PlanDesc{handle: df.handle}
+		if len(cOps) > 0 {
+			plan.operations = &cOps[0]
+			plan.count = C.size_t(len(cOps))
+		}
+		plans = append(plans, plan)
+		indices = append(indices, i)
+	}
+
+	if len(plans) > 0 {
+		results := make([]C.FfiResult, len(plans))
+		if C.execute_batch(&plans[0], C.size_t(len(plans)), &results[0]) != 0 {
+			return nil, errors.New("CollectAll: invalid batch arguments")
+		}
+
+		for j, result := range results {
+			i := indices[j]
+			if err := resultError(result); err != nil {
+				errs[i] = err
+				continue
+			}
+
+			df := dfs[i]
+			oldHandle := df.handle.handle
+			df.handle = result.polars_handle
+			if oldHandle != 0 && oldHandle != df.handle.handle {
+				C.release_dataframe(oldHandle)
+			}
+		}
+	}
+
+	var failures []error
+	for i, err := range errs {
+		if err != nil {
+			failures = append(failures, fmt.Errorf("CollectAll: pipeline %d: %w", i, err))
+		}
+	}
+	return dfs, errors.Join(failures...)
+}
@@ -0,0 +1,85 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestCollectAll verifies independent pipelines are collected in one batch call
+func TestCollectAll(t *testing.T) {
+	t.Run("IndependentPipelines", func(t *testing.T) {
+		engineers := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Engineering"))).
+			Select("name")
+		counts := ReadCSV("../testdata/sample.csv").
+			GroupBy("department").
+			Agg(Col("name").Count().Alias("count")).
+			Sort([]string{"department"})
+		top := ReadCSV("../testdata/sample.csv").
+			SortBy([]SortField{Desc("salary")}).
+			Limit(1).
+			Select("name", "salary")
+
+		results, err := CollectAll(engineers, counts, top)
+		require.NoError(t, err)
+		require.Len(t, results, 3)
+		for _, result := range results {
+			defer result.Release()
+		}
+
+		height, err := results[0].Height()
+		require.NoError(t, err)
+		require.Equal(t, 3, height)
+
+		expected := `shape: (3, 2)
+┌─────────────┬───────┐
+│ department  ┆ count │
+│ ---         ┆ ---   │
+│ str         ┆ u32   │
+╞═════════════╪═══════╡
+│ Engineering ┆ 3     │
+│ Marketing   ┆ 2     │
+│ Sales       ┆ 2     │
+└─────────────┴───────┘`
+		require.Equal(t, expected, results[1].String())
+
+		expected = `shape: (1, 2)
+┌─────────┬────────┐
+│ name    ┆ salary │
+│ ---     ┆ ---    │
+│ str     ┆ i64    │
+╞═════════╪════════╡
+│ Charlie ┆ 70000  │
+└─────────┴────────┘`
+		require.Equal(t, expected, results[2].String())
+	})
+
+	t.Run("PartialFailure", func(t *testing.T) {
+		good := ReadCSV("../testdata/sample.csv").Limit(2)
+		bad := ReadCSV("../testdata/sample.csv").GroupBy("department") // No agg()
+
+		results, err := CollectAll(good, bad)
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "pipeline 1")
+		require.Contains(t, err.Error(), "Call agg() first")
+		defer results[0].Release()
+
+		height, err := results[0].Height()
+		require.NoError(t, err)
+		require.Equal(t, 2, height)
+	})
+
+	t.Run("AlreadyCollected", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+
+		results, err := CollectAll(df)
+		require.NoError(t, err)
+		defer results[0].Release()
+
+		height, err := results[0].Height()
+		require.NoError(t, err)
+		require.Equal(t, 7, height)
+	})
+}
@@ -0,0 +1,56 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+
+// CacheStats reports the state of the result cache
+type CacheStats struct {
+	Hits      uint64
+	Misses    uint64
+	Evictions uint64
+	Entries   int
+	Bytes     int // Estimated size of the cached frames
+	MaxBytes  int // Byte budget (0 = cache disabled)
+}
+
+// EnableResultCache turns on the process-wide result cache with a byte budget
+// Collect() on a chain that starts from ReadCSV/ReadParquet is then keyed on its
+// encoded operations (reader options included) plus the size and mtime of each
+// source file; a repeated query over unchanged files returns the cached frame
+// (shared, not copied) without running.
+// Least recently used frames are evicted beyond maxBytes. Chains that start from
+// an existing handle, join or concat other frames, or read globs are never cached.
+// Calling it again resizes the budget.
+func EnableResultCache(maxBytes int) {
+	if maxBytes <= 0 {
+		DisableResultCache()
+		return
+	}
+	C.configure_result_cache(C.size_t(maxBytes))
+}
+
+// DisableResultCache drops all cached frames and resets the counters
+func DisableResultCache() {
+	C.configure_result_cache(0)
+}
+
+// ClearResultCache drops all cached frames, keeping the budget and counters
+func ClearResultCache() {
+	C.clear_result_cache()
+}
+
+// ResultCacheStats returns the result cache counters (all zero while disabled)
+func ResultCacheStats() CacheStats {
+	var stats C.CacheStats
+	C.result_cache_stats(&stats)
+	return CacheStats{
+		Hits:      uint64(stats.hits),
+		Misses:    uint64(stats.misses),
+		Evictions: uint64(stats.evictions),
+		Entries:   int(stats.entries),
+		Bytes:     int(stats.bytes),
+		MaxBytes:  int(stats.max_bytes),
+	}
+}
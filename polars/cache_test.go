@@ -0,0 +1,127 @@
+package polars
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestResultCache verifies hits, source invalidation and LRU eviction
+func TestResultCache(t *testing.T) {
+	// Queries run against a private copy so its mtime can be changed
+	copySample := func(t *testing.T) string {
+		data, err := os.ReadFile("../testdata/sample.csv")
+		require.NoError(t, err)
+		path := filepath.Join(t.TempDir(), "sample.csv")
+		require.NoError(t, os.WriteFile(path, data, 0o644))
+		return path
+	}
+
+	collectHeight := func(t *testing.T, df *DataFrame) int {
+		result, err := df.Collect()
+		require.NoError(t, err)
+		defer result.Release()
+		height, err := result.Height()
+		require.NoError(t, err)
+		return height
+	}
+
+	t.Run("RepeatedQueryHits", func(t *testing.T) {
+		EnableResultCache(64 << 20)
+		defer DisableResultCache()
+		path := copySample(t)
+
+		for range 3 {
+			require.Equal(t, 4, collectHeight(t, ReadCSV(path).Filter(Col("age").Gt(Lit(28)))))
+		}
+
+		stats := ResultCacheStats()
+		require.Equal(t, uint64(1), stats.Misses)
+		require.Equal(t, uint64(2), stats.Hits)
+		require.Equal(t, 1, stats.Entries)
+		require.Positive(t, stats.Bytes)
+	})
+
+	t.Run("ModifiedSourceMisses", func(t *testing.T) {
+		EnableResultCache(64 << 20)
+		defer DisableResultCache()
+		path := copySample(t)
+
+		require.Equal(t, 4, collectHeight(t, ReadCSV(path).Filter(Col("age").Gt(Lit(28)))))
+
+		file, err := os.OpenFile(path, os.O_APPEND|os.O_WRONLY, 0)
+		require.NoError(t, err)
+		_, err = file.WriteString("Heidi,40,80000,Sales\n")
+		require.NoError(t, err)
+		require.NoError(t, file.Close())
+		later := time.Now().Add(time.Minute)
+		require.NoError(t, os.Chtimes(path, later, later))
+
+		require.Equal(t, 5, collectHeight(t, ReadCSV(path).Filter(Col("age").Gt(Lit(28)))))
+		stats := ResultCacheStats()
+		require.Equal(t, uint64(2), stats.Misses)
+		require.Equal(t, uint64(0), stats.Hits)
+	})
+
+	t.Run("EvictsLeastRecentlyUsed", func(t *testing.T) {
+		EnableResultCache(64 << 20)
+		defer DisableResultCache()
+		path := copySample(t)
+
+		// Both filters keep every row, so the cached frames are the same size
+		require.Equal(t, 7, collectHeight(t, ReadCSV(path).Filter(Col("age").Gt(Lit(0)))))
+		EnableResultCache(ResultCacheStats().Bytes) // Room for exactly one frame
+
+		require.Equal(t, 7, collectHeight(t, ReadCSV(path).Filter(Col("age").Lt(Lit(100)))))
+		stats := ResultCacheStats()
+		require.Equal(t, uint64(1), stats.Evictions)
+		require.Equal(t, 1, stats.Entries)
+	})
+
+	t.Run("ReaderOptionsMiss", func(t *testing.T) {
+		EnableResultCache(64 << 20)
+		defer DisableResultCache()
+		path := copySample(t)
+
+		// Same file and plan shape; only the reader args differ
+		require.Equal(t, 7, collectHeight(t, ReadCSV(path)))
+		require.Equal(t, 3, collectHeight(t, ReadCSVWithOptions(path, CsvOptions{HasHeader: true, NRows: 3})))
+		require.Equal(t, 5, collectHeight(t, ReadCSVWithOptions(path, CsvOptions{HasHeader: true, SkipRows: 2})))
+
+		stats := ResultCacheStats()
+		require.Equal(t, uint64(3), stats.Misses)
+		require.Equal(t, uint64(0), stats.Hits)
+		require.Equal(t, 3, stats.Entries)
+	})
+
+	t.Run("SharedInputNotCached", func(t *testing.T) {
+		EnableResultCache(64 << 20)
+		defer DisableResultCache()
+		path := copySample(t)
+
+		base, err := ReadCSV(path).Collect() // Cached itself: the chain starts from a read
+		require.NoError(t, err)
+		defer base.Release()
+
+		// These chains start from an existing handle whose sources the cache cannot see
+		for range 2 {
+			shared, err := base.Share()
+			require.NoError(t, err)
+			require.Equal(t, 4, collectHeight(t, shared.Filter(Col("age").Gt(Lit(28)))))
+		}
+
+		stats := ResultCacheStats()
+		require.Equal(t, uint64(1), stats.Misses)
+		require.Equal(t, uint64(0), stats.Hits)
+		require.Equal(t, 1, stats.Entries)
+	})
+
+	t.Run("Disabled", func(t *testing.T) {
+		path := copySample(t)
+		require.Equal(t, 4, collectHeight(t, ReadCSV(path).Filter(Col("age").Gt(Lit(28)))))
+		require.Equal(t, CacheStats{}, ResultCacheStats())
+	})
+}
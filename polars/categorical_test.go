@@ -0,0 +1,83 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestCategoricalTypes verifies Enum casts and categorical joins under the string cache
+func TestCategoricalTypes(t *testing.T) {
+	t.Run("Enum", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			Select(Col("name"), Col("department").CastEnum("Sales", "Marketing", "Engineering").Alias("dept")).
+			SortBy([]SortField{{Column: "dept"}, {Column: "name"}}).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		require.Equal(t, ColumnType{Name: "dept", Type: Enum}, schema[1])
+
+		// Enums sort in category order, not lexically
+		offsets := make([]int64, 8)
+		data := make([]byte, 64)
+		require.NoError(t, df.StringColumn("dept", offsets, data, nil))
+		require.Equal(t, "Sales", string(data[offsets[0]:offsets[1]]))
+		require.Equal(t, "Engineering", string(data[offsets[6]:offsets[7]]))
+	})
+
+	t.Run("EnumErrors", func(t *testing.T) {
+		_, err := ReadCSV("../testdata/sample.csv").Select(Col("department").CastEnum()).Collect()
+		require.Error(t, err)
+
+		_, err = ReadCSV("../testdata/sample.csv").Select(Col("department").CastEnum("Sales", "Sales")).Collect()
+		require.Error(t, err)
+
+		// Enum categories cannot be carried by the bare dtype
+		_, err = ReadCSV("../testdata/sample.csv").Select(Col("department").Cast(Enum)).Collect()
+		require.Error(t, err)
+	})
+
+	t.Run("StringCacheNesting", func(t *testing.T) {
+		require.False(t, StringCacheEnabled())
+
+		outer := EnableStringCache()
+		inner := EnableStringCache()
+		inner.Release()
+		require.True(t, StringCacheEnabled())
+
+		outer.Release()
+		outer.Release() // No-op
+		require.False(t, StringCacheEnabled())
+	})
+
+	t.Run("CategoricalJoin", func(t *testing.T) {
+		err := WithStringCache(func() error {
+			left, err := ReadCSV("../testdata/sample.csv").
+				WithColumns(Col("department").Cast(Categorical)).
+				Collect()
+			require.NoError(t, err)
+			defer left.Release()
+
+			right, err := ReadCSV("../testdata/sample.csv").
+				WithColumns(Col("department").Cast(Categorical)).
+				GroupBy("department").
+				Agg(Col("salary").Mean().Alias("avg_salary")).
+				Collect()
+			require.NoError(t, err)
+			defer right.Release()
+
+			joined, err := left.InnerJoin(right, "department").Collect()
+			require.NoError(t, err)
+
+			height, err := joined.Height()
+			require.NoError(t, err)
+			require.Equal(t, 7, height)
+			return nil
+		})
+		require.NoError(t, err)
+		require.False(t, StringCacheEnabled())
+	})
+}
@@ -0,0 +1,131 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"fmt"
+	"unsafe"
+)
+
+// ColumnInfo describes one column of a collected DataFrame
+type ColumnInfo struct {
+	Type        DataType // 0 when the column type has no DataType constant (lists, structs...)
+	Len         int
+	NullCount   int
+	StringBytes int // Total UTF-8 bytes of a String, Categorical or Enum column
+}
+
+// ValidityLen is the size in bytes of the validity bitmap of an n-row column
+func ValidityLen(n int) int {
+	return (n + 7) / 8
+}
+
+// IsValid reports whether row i is non-null in a validity bitmap filled by the *Column methods
+func IsValid(validity []byte, i int) bool {
+	return validity[i/8]&(1<<(i%8)) != 0
+}
+
+// ColumnInfo returns the type and size of a column, e.g. to size the buffers of the *Column methods
+func (df *DataFrame) ColumnInfo(name string) (ColumnInfo, error) {
+	if err := df.requireCollected(); err != nil {
+		return ColumnInfo{}, err
+	}
+
+	var info C.ColumnInfo
+	if rc := C.dataframe_column_info(df.handle.handle, makeRawStr(name), &info); rc != 0 {
+		return ColumnInfo{}, columnError(rc, name)
+	}
+	return ColumnInfo{
+		Type:        DataType(info.dtype),
+		Len:         int(info.len),
+		NullCount:   int(info.null_count),
+		StringBytes: int(info.string_bytes),
+	}, nil
+}
+
+// Int64Column copies a column into values, which must have exactly one slot per row
+// Integer columns of other widths are converted; values that do not fit fail the
+// copy. validity may be nil; otherwise it receives the null bitmap (see IsValid)
+// and needs ValidityLen(len(values)) bytes. Values of null rows are unspecified.
+func (df *DataFrame) Int64Column(name string, values []int64, validity []byte) error {
+	return df.copyColumn(name, Int64, len(values), unsafe.Pointer(unsafe.SliceData(values)),
+		len(values)*8, nil, validity)
+}
+
+// Float64Column copies a column into values, which must have exactly one slot per row
+// Integer and Float32 columns are converted. See Int64Column for validity.
+func (df *DataFrame) Float64Column(name string, values []float64, validity []byte) error {
+	return df.copyColumn(name, Float64, len(values), unsafe.Pointer(unsafe.SliceData(values)),
+		len(values)*8, nil, validity)
+}
+
+// BoolColumn copies a Boolean column into values, which must have exactly one slot per row
+// See Int64Column for validity.
+func (df *DataFrame) BoolColumn(name string, values []bool, validity []byte) error {
+	return df.copyColumn(name, Boolean, len(values), unsafe.Pointer(unsafe.SliceData(values)),
+		len(values), nil, validity)
+}
+
+// StringColumn copies a column as Arrow-style offsets plus concatenated UTF-8 bytes
+// offsets needs one entry per row plus one: row i is data[offsets[i]:offsets[i+1]].
+// data needs ColumnInfo.StringBytes bytes; null rows are empty. Categorical and Enum
+// columns are read as their string values. See Int64Column for validity.
+func (df *DataFrame) StringColumn(name string, offsets []int64, data []byte, validity []byte) error {
+	if len(offsets) == 0 {
+		return errors.New("StringColumn: offsets needs one entry per row plus one")
+	}
+	return df.copyColumn(name, String, len(offsets)-1, unsafe.Pointer(unsafe.SliceData(data)),
+		len(data), (*C.int64_t)(unsafe.Pointer(&offsets[0])), validity)
+}
+
+// copyColumn copies a column into Go buffers with a single FFI call
+// The buffers hold no Go pointers, so they are passed to Rust directly.
+func (df *DataFrame) copyColumn(name string, dtype DataType, rows int, values unsafe.Pointer,
+	valuesBytes int, offsets *C.int64_t, validity []byte) error {
+	if err := df.requireCollected(); err != nil {
+		return err
+	}
+
+	var validityPtr *C.uint8_t
+	if validity != nil {
+		if len(validity) < ValidityLen(rows) {
+			return fmt.Errorf("column %q: validity needs %d bytes, got %d", name, ValidityLen(rows), len(validity))
+		}
+		validityPtr = (*C.uint8_t)(unsafe.Pointer(&validity[0]))
+	}
+
+	rc := C.dataframe_copy_column(df.handle.handle, makeRawStr(name), C.uint32_t(dtype), C.size_t(rows),
+		values, C.size_t(valuesBytes), offsets, validityPtr)
+	if rc != 0 {
+		return columnError(rc, name)
+	}
+	return nil
+}
+
+// requireCollected checks the DataFrame holds a materialized frame
+func (df *DataFrame) requireCollected() error {
+	if df.handle.handle == 0 {
+		return errors.New("dataframe not executed - call Collect() first")
+	}
+	if df.handle.context_type != contextDataFrame {
+		return errors.New("column access requires a collected DataFrame - call Collect() first")
+	}
+	return nil
+}
+
+// columnError converts a column accessor return code into an error
+func columnError(rc C.int, name string) error {
+	switch rc {
+	case C.ERROR_NULL_HANDLE:
+		return errors.New("invalid or released handle")
+	case C.ERROR_NULL_ARGS:
+		return fmt.Errorf("column %q: buffer sizes do not match the column", name)
+	case C.ERROR_INVALID_UTF8:
+		return errors.New("column name is not valid UTF-8")
+	default:
+		return fmt.Errorf("column %q: not found or not convertible to the requested type", name)
+	}
+}
@@ -0,0 +1,121 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestColumnExtraction verifies typed copies of collected columns into Go slices
+func TestColumnExtraction(t *testing.T) {
+	t.Run("NumericColumns", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			Select("age", "salary", "salary > 60000 AS high").
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("age")
+		require.NoError(t, err)
+		require.Equal(t, Int64, info.Type)
+		require.Equal(t, 7, info.Len)
+		require.Zero(t, info.NullCount)
+
+		ages := make([]int64, info.Len)
+		require.NoError(t, df.Int64Column("age", ages, nil))
+		require.Equal(t, []int64{25, 30, 35, 28, 32, 29, 27}, ages)
+
+		// Integer columns convert to float64
+		salaries := make([]float64, info.Len)
+		require.NoError(t, df.Float64Column("salary", salaries, nil))
+		require.Equal(t, 70000.0, salaries[2])
+
+		high := make([]bool, info.Len)
+		require.NoError(t, df.BoolColumn("high", high, nil))
+		require.Equal(t, []bool{false, false, true, false, true, false, false}, high)
+	})
+
+	t.Run("StringColumn", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Select("name").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("name")
+		require.NoError(t, err)
+		require.Equal(t, String, info.Type)
+
+		offsets := make([]int64, info.Len+1)
+		data := make([]byte, info.StringBytes)
+		require.NoError(t, df.StringColumn("name", offsets, data, nil))
+		require.Equal(t, "Alice", string(data[offsets[0]:offsets[1]]))
+		require.Equal(t, "Grace", string(data[offsets[6]:offsets[7]]))
+	})
+
+	t.Run("EnumColumn", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			Select(Col("department").CastEnum("Sales", "Marketing", "Engineering")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("department")
+		require.NoError(t, err)
+		require.Equal(t, Enum, info.Type)
+		require.Equal(t, 61, info.StringBytes) // 3 Engineering, 2 Marketing, 2 Sales
+
+		offsets := make([]int64, info.Len+1)
+		data := make([]byte, info.StringBytes)
+		require.NoError(t, df.StringColumn("department", offsets, data, nil))
+		require.Equal(t, "Engineering", string(data[offsets[0]:offsets[1]]))
+		require.Equal(t, "Sales", string(data[offsets[6]:offsets[7]]))
+	})
+
+	t.Run("Validity", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Select("age", "name").Collect()
+		require.NoError(t, err)
+		df, err = df.addNullRowForTesting().execute()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("age")
+		require.NoError(t, err)
+		require.Equal(t, 8, info.Len)
+		require.Equal(t, 1, info.NullCount)
+
+		ages := make([]int64, info.Len)
+		validity := make([]byte, ValidityLen(info.Len))
+		require.NoError(t, df.Int64Column("age", ages, validity))
+		require.True(t, IsValid(validity, 0))
+		require.False(t, IsValid(validity, 7))
+
+		offsets := make([]int64, info.Len+1)
+		nameInfo, err := df.ColumnInfo("name")
+		require.NoError(t, err)
+		data := make([]byte, nameInfo.StringBytes)
+		require.NoError(t, df.StringColumn("name", offsets, data, validity))
+		require.False(t, IsValid(validity, 7))
+		require.Equal(t, offsets[7], offsets[8]) // Null rows are empty
+	})
+
+	t.Run("Errors", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		_, err = df.ColumnInfo("missing")
+		require.Error(t, err)
+
+		// Buffer length must match the column
+		require.Error(t, df.Int64Column("age", make([]int64, 3), nil))
+		require.Error(t, df.Int64Column("age", make([]int64, 7), make([]byte, 0)))
+
+		// Strict conversion: names are not numbers
+		require.Error(t, df.Int64Column("name", make([]int64, 7), nil))
+
+		// Data buffer too small for the strings
+		require.Error(t, df.StringColumn("name", make([]int64, 8), make([]byte, 4), nil))
+
+		_, err = ReadCSV("../testdata/sample.csv").ColumnInfo("age")
+		require.Error(t, err)
+	})
+}
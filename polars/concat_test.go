@@ -0,0 +1,142 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestConcat verifies lazy concatenation of pending and executed inputs
+func TestConcat(t *testing.T) {
+	height := func(t *testing.T, df *DataFrame) int {
+		t.Helper()
+		result, err := df.Collect()
+		require.NoError(t, err)
+		defer result.Release()
+		rows, err := result.Height()
+		require.NoError(t, err)
+		return rows
+	}
+
+	t.Run("PendingInputs", func(t *testing.T) {
+		df1 := ReadCSV("../testdata/sample.csv")
+		defer df1.Release()
+		df2 := ReadCSV("../testdata/sample.csv")
+		defer df2.Release()
+
+		concat := Concat(df1, df2)
+		defer concat.Release()
+		require.Equal(t, 4, height(t, concat.Filter(Col("age").Gt(Lit(30)))))
+
+		// Inputs are built from snapshots, so the callers' pipelines stay pending
+		require.Zero(t, df1.handle.handle)
+		require.NotEmpty(t, df1.operations)
+		require.Equal(t, 7, height(t, df1))
+	})
+
+	t.Run("DeferredInputs", func(t *testing.T) {
+		before := LiveHandles()
+		missing := ReadCSV("../testdata/missing.csv")
+		concat := Concat(missing)
+		require.Equal(t, before, LiveHandles()) // Nothing ran yet
+
+		_, err := concat.Collect()
+		require.Error(t, err) // Surfaces from the concat's execution
+		require.Equal(t, before, LiveHandles()) // Built inputs are released with the call
+	})
+
+	t.Run("LazyResult", func(t *testing.T) {
+		collected, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		defer collected.Release()
+		pending := ReadCSV("../testdata/sample.csv")
+		defer pending.Release()
+
+		// Mixed executed and pending inputs concatenate into an uncollected plan
+		df := Concat(collected, pending).Filter(Col("age").Gt(Lit(30)))
+		defer df.Release()
+		plan, err := df.Explain(true)
+		require.NoError(t, err)
+		require.Equal(t, contextLazyFrame, int(df.handle.context_type))
+
+		// The filter reaches the scan below the union
+		require.Contains(t, plan, "UNION")
+		require.Contains(t, plan, "SELECTION")
+		require.Equal(t, 4, height(t, df))
+	})
+
+	t.Run("Diagonal", func(t *testing.T) {
+		ages := ReadCSV("../testdata/sample.csv").Select("name", "age")
+		salaries := ReadCSV("../testdata/sample.csv").Select("name", "salary")
+		defer ages.Release()
+		defer salaries.Release()
+
+		result, err := ConcatWithOptions(ConcatOptions{Mode: ConcatDiagonal}, ages, salaries).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		schema, err := result.Schema()
+		require.NoError(t, err)
+		require.Len(t, schema, 3)
+		info, err := result.ColumnInfo("salary")
+		require.NoError(t, err)
+		require.Equal(t, 7, info.NullCount) // Missing from the first input
+
+		// Vertical concat requires matching columns
+		_, err = Concat(ages, salaries).Collect()
+		require.Error(t, err)
+	})
+
+	t.Run("Relaxed", func(t *testing.T) {
+		ints := ReadCSV("../testdata/sample.csv").Select("age")
+		floats := ReadCSV("../testdata/sample.csv").Select(Col("age").Cast(Float64))
+		defer ints.Release()
+		defer floats.Release()
+
+		opts := ConcatOptions{Mode: ConcatVerticalRelaxed, Sequential: true}
+		result, err := ConcatWithOptions(opts, ints, floats).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		values := make([]float64, 14)
+		require.NoError(t, result.Float64Column("age", values, nil))
+		require.Equal(t, values[:7], values[7:])
+	})
+
+	t.Run("InvalidInputs", func(t *testing.T) {
+		_, err := Concat(ReadCSV("../testdata/sample.csv"), nil).Collect()
+		require.ErrorContains(t, err, "input 1 is nil")
+
+		_, err = ConcatWithOptions(ConcatOptions{Mode: 9}, ReadCSV("../testdata/sample.csv")).Collect()
+		require.ErrorContains(t, err, "invalid mode")
+
+		_, err = Concat(ReadCSV("../testdata/missing.csv")).Collect()
+		require.Error(t, err)
+	})
+
+	t.Run("Encoded", func(t *testing.T) {
+		df1, err := ReadCSV("../testdata/sample.csv").Select("name", "age").Collect()
+		require.NoError(t, err)
+		defer df1.Release()
+		df2, err := ReadCSV("../testdata/sample.csv").Select("name").Collect()
+		require.NoError(t, err)
+		defer df2.Release()
+
+		// Pending inputs would be built and released before the program runs
+		_, err = Concat(ReadCSV("../testdata/sample.csv")).Encode()
+		require.ErrorContains(t, err, "cannot be encoded")
+
+		program, err := ConcatWithOptions(ConcatOptions{Mode: ConcatDiagonal}, df1, df2).Encode()
+		require.NoError(t, err)
+		decoded, err := ExecuteEncoded(program)
+		require.NoError(t, err)
+		defer decoded.Release()
+
+		info, err := decoded.Collect()
+		require.NoError(t, err)
+		defer info.Release()
+		column, err := info.ColumnInfo("age")
+		require.NoError(t, err)
+		require.Equal(t, 7, column.NullCount)
+	})
+}
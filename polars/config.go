@@ -0,0 +1,70 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"context"
+	"fmt"
+)
+
+// Config sizes the Rust runtime shared by every query in the process
+// Zero fields keep the Polars defaults.
+type Config struct {
+	Threads       int   // Polars worker threads (0 = POLARS_MAX_THREADS or one per core)
+	StackSize     int   // Worker thread stack size in bytes (0 = Rust default of 2 MiB)
+	CPUs          []int // Pin workers to these cores, round robin (nil = unpinned, Linux only)
+	MaxConcurrent int   // Executions allowed to run at once, others wait (0 = unlimited)
+}
+
+// Configure applies process-wide runtime settings
+// Polars starts its thread pool on the first query and never resizes it, so call
+// Configure once at startup, before any query runs; setting Threads or StackSize
+// after the pool started is an error. Pinning workers to the cores of one socket keeps a service
+// on its NUMA node, and several services on one host can split the cores between
+// them instead of each starting a worker per core. MaxConcurrent bounds how many
+// executions run at once; further calls queue until one finishes. It can be
+// overridden per call with WithConcurrencyLimit. Configure succeeds at most once.
+func Configure(config Config) error {
+	if config.Threads < 0 || config.StackSize < 0 || config.MaxConcurrent < 0 {
+		return fmt.Errorf("invalid config: negative value in %+v", config)
+	}
+
+	arena := &argArena{}
+	defer arena.free()
+	cConfig := C.FirnConfig{
+		num_threads:    C.size_t(config.Threads),
+		stack_size:     C.size_t(config.StackSize),
+		cpu_count:      C.size_t(len(config.CPUs)),
+		max_concurrent: C.size_t(config.MaxConcurrent),
+	}
+	if len(config.CPUs) > 0 {
+		cpus := arenaSlice[C.size_t](arena, len(config.CPUs))
+		for i, cpu := range config.CPUs {
+			if cpu < 0 {
+				return fmt.Errorf("invalid config: negative CPU %d", cpu)
+			}
+			cpus[i] = C.size_t(cpu)
+		}
+		cConfig.cpus = &cpus[0]
+	}
+
+	return resultError(C.firn_init(&cConfig))
+}
+
+type concurrencyKey struct{}
+
+// WithConcurrencyLimit returns a context under which CollectContext waits until
+// fewer than limit executions are running, overriding Config.MaxConcurrent
+// Use a low limit for background jobs so they cannot crowd out interactive
+// queries. A call that is cancelled or times out while waiting returns ctx.Err().
+func WithConcurrencyLimit(ctx context.Context, limit int) context.Context {
+	return context.WithValue(ctx, concurrencyKey{}, max(limit, 0))
+}
+
+// concurrencyLimit returns the limit set by WithConcurrencyLimit (0 = default)
+func concurrencyLimit(ctx context.Context) C.size_t {
+	limit, _ := ctx.Value(concurrencyKey{}).(int)
+	return C.size_t(limit)
+}
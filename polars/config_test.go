@@ -0,0 +1,57 @@
+package polars
+
+import (
+	"context"
+	"runtime"
+	"sync"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestConfigure verifies runtime configuration and per-call concurrency limits
+func TestConfigure(t *testing.T) {
+	t.Run("Configure", func(t *testing.T) {
+		// Ensure the Polars thread pool is running
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		df.Release()
+
+		// The running pool cannot be resized, nor its workers' stacks
+		err = Configure(Config{Threads: runtime.NumCPU() + 1})
+		require.ErrorContains(t, err, "already started")
+		err = Configure(Config{StackSize: 8 << 20})
+		require.ErrorContains(t, err, "already started")
+
+		require.Error(t, Configure(Config{CPUs: []int{-1}}))
+		require.Error(t, Configure(Config{MaxConcurrent: -1}))
+
+		require.NoError(t, Configure(Config{}))
+		require.ErrorContains(t, Configure(Config{}), "already called")
+	})
+
+	t.Run("ConcurrencyLimit", func(t *testing.T) {
+		ctx := WithConcurrencyLimit(context.Background(), 1)
+
+		var wg sync.WaitGroup
+		errs := make([]error, 8)
+		for i := range errs {
+			wg.Add(1)
+			go func() {
+				defer wg.Done()
+				result, err := ReadCSV("../testdata/sample.csv").
+					Filter(Col("age").Gt(Lit(30))).
+					CollectContext(ctx)
+				if err == nil {
+					result.Release()
+				}
+				errs[i] = err
+			}()
+		}
+		wg.Wait()
+
+		for _, err := range errs {
+			require.NoError(t, err)
+		}
+	})
+}
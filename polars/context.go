@@ -0,0 +1,77 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"context"
+	"errors"
+	"runtime"
+	"sync/atomic"
+	"time"
+	"unsafe"
+)
+
+// CollectContext materializes the result like Collect, stopping early when ctx is done
+// Cancellation is checked between operations and while Polars collects, so a long
+// query aborts at the next operator boundary instead of running to completion.
+// A ctx deadline is also enforced on the Rust side. Interrupted calls return
+// ctx.Err() (context.Canceled or context.DeadlineExceeded).
+func (df *DataFrame) CollectContext(ctx context.Context) (*DataFrame, error) {
+	df.operations = append(df.operations, Operation{
+		opcode: OpCollect,
+		args:   noArgs,
+	})
+
+	return df.executeContext(ctx)
+}
+
+// executeContext runs the pending operations under the stop conditions of ctx
+func (df *DataFrame) executeContext(ctx context.Context) (*DataFrame, error) {
+	if err := ctx.Err(); err != nil {
+		df.operations = df.operations[:0]
+		return nil, err
+	}
+
+	// Rust reads the flag atomically for the duration of the call
+	cancelled := new(int32)
+	var pinner runtime.Pinner
+	pinner.Pin(cancelled)
+	defer pinner.Unpin()
+
+	options := C.ExecutionOptions{
+		cancelled:      (*C.int32_t)(unsafe.Pointer(cancelled)),
+		max_concurrent: concurrencyLimit(ctx),
+	}
+	if deadline, ok := ctx.Deadline(); ok {
+		options.timeout_ms = C.uint64_t(max(time.Until(deadline).Milliseconds(), 1))
+	}
+
+	stop := context.AfterFunc(ctx, func() {
+		atomic.StoreInt32(cancelled, 1)
+	})
+	defer stop()
+
+	result, err := df.executeWith(&options)
+	return result, interruptError(ctx, err)
+}
+
+// interruptError maps a Rust-side interruption onto the matching context error
+func interruptError(ctx context.Context, err error) error {
+	var polarsErr *Error
+	if !errors.As(err, &polarsErr) {
+		return err
+	}
+
+	switch polarsErr.Code {
+	case C.ERROR_CANCELLED:
+		if ctxErr := ctx.Err(); ctxErr != nil {
+			return ctxErr
+		}
+		return context.Canceled
+	case C.ERROR_DEADLINE_EXCEEDED:
+		return context.DeadlineExceeded // Rust may observe the deadline just before ctx does
+	}
+	return err
+}
@@ -0,0 +1,77 @@
+package polars
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestCollectContext verifies context cancellation and deadlines reach execute_operations
+func TestCollectContext(t *testing.T) {
+	t.Run("Completes", func(t *testing.T) {
+		ctx, cancel := context.WithTimeout(context.Background(), time.Minute)
+		defer cancel()
+
+		result, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Lit(30))).
+			CollectContext(ctx)
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 2, height)
+	})
+
+	t.Run("AlreadyCancelled", func(t *testing.T) {
+		ctx, cancel := context.WithCancel(context.Background())
+		cancel()
+
+		_, err := ReadCSV("../testdata/sample.csv").CollectContext(ctx)
+		require.ErrorIs(t, err, context.Canceled)
+	})
+
+	t.Run("DeadlinePassed", func(t *testing.T) {
+		ctx, cancel := context.WithDeadline(context.Background(), time.Now().Add(-time.Second))
+		defer cancel()
+
+		_, err := ReadCSV("../testdata/sample.csv").CollectContext(ctx)
+		require.ErrorIs(t, err, context.DeadlineExceeded)
+	})
+
+	t.Run("CancelledMidCollect", func(t *testing.T) {
+		// 2000 x 2000 cross join grouped on v*2001+w, distinct for every (v, w) pair, so
+		// 4M groups - far slower than the cancel delay
+		var csv strings.Builder
+		csv.WriteString("v\n")
+		for i := 1; i <= 2000; i++ {
+			fmt.Fprintf(&csv, "%d\n", i)
+		}
+		path := filepath.Join(t.TempDir(), "values.csv")
+		require.NoError(t, os.WriteFile(path, []byte(csv.String()), 0o644))
+
+		right, err := ReadCSV(path).Select(Col("v").Alias("w")).Collect()
+		require.NoError(t, err)
+		defer right.Release()
+
+		ctx, cancel := context.WithCancel(context.Background())
+		defer cancel()
+		time.AfterFunc(50*time.Millisecond, cancel) // Fires while Polars is collecting
+
+		start := time.Now()
+		_, err = ReadCSV(path).
+			CrossJoin(right).
+			WithColumns(Col("v").Mul(Lit(2001)).Add(Col("w")).Alias("p")).
+			GroupBy(Col("p")).
+			Agg(Col("v").Count().Alias("n")).
+			CollectContext(ctx)
+		require.ErrorIs(t, err, context.Canceled)
+		require.Less(t, time.Since(start), 10*time.Second) // The stop flag aborts the running query
+	})
+}
@@ -0,0 +1,131 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"iter"
+	"unsafe"
+)
+
+// BatchCursor hands out a collected result as a sequence of Arrow record batches
+// The result is fully materialized when the cursor is opened, so it does not lower
+// peak memory compared to Collect; it pages the result for consumers that work in
+// chunks. Each batch is a zero-copy slice sharing the buffers of the collected frame.
+type BatchCursor struct {
+	handle C.uintptr_t
+}
+
+// Cursor executes the pending operations and opens a batch cursor over the result
+// opts select the collect engine (e.g. Streaming) exactly as in CollectWithOptions.
+// The DataFrame's pending operations are cleared; the cursor must be closed with Close().
+func (df *DataFrame) Cursor(opts CollectOptions) (*BatchCursor, error) {
+	df.operations = append(df.operations, collectOperation(opts))
+	defer func() {
+		df.operations = df.operations[:0]
+	}()
+
+	arena := &argArena{}
+	defer arena.free()
+	cOps, err := df.buildOperations(arena)
+	if err != nil {
+		return nil, err
+	}
+
+	result := C.open_batch_cursor(df.handle, &cOps[0], C.size_t(len(cOps)))
+	if err := resultError(result); err != nil {
+		return nil, err
+	}
+
+	return &BatchCursor{handle: result.polars_handle.handle}, nil
+}
+
+// Next returns the next batch of at most maxRows rows, or nil once the cursor is exhausted
+// The caller owns the returned batch and must Release() it.
+func (c *BatchCursor) Next(maxRows int) (*ArrowBatch, error) {
+	if c.handle == 0 {
+		return nil, errors.New("batch cursor has been closed")
+	}
+	if maxRows <= 0 {
+		return nil, errors.New("maxRows must be positive")
+	}
+
+	array := (*C.struct_ArrowArray)(C.calloc(1, C.sizeof_struct_ArrowArray))
+	schema := (*C.struct_ArrowSchema)(C.calloc(1, C.sizeof_struct_ArrowSchema))
+
+	if rc := C.next_batch(c.handle, C.size_t(maxRows), array, schema); rc != 0 {
+		C.free(unsafe.Pointer(array))
+		C.free(unsafe.Pointer(schema))
+		return nil, &Error{
+			Code:    int(rc),
+			Message: "failed to export next batch",
+		}
+	}
+
+	if array.release == nil {
+		// End of data - nothing to release
+		C.free(unsafe.Pointer(array))
+		C.free(unsafe.Pointer(schema))
+		return nil, nil
+	}
+
+	return &ArrowBatch{array: array, schema: schema}, nil
+}
+
+// Close releases the cursor and any rows it has not handed out
+// Batches already returned by Next remain valid until they are released.
+func (c *BatchCursor) Close() error {
+	if c.handle == 0 {
+		return nil
+	}
+
+	if C.release_batch_cursor(c.handle) != 0 {
+		return errors.New("failed to release batch cursor")
+	}
+
+	c.handle = 0
+	return nil
+}
+
+// Batches executes the pending operations and yields the result in batches of at most maxRows rows
+// Each batch is released once the loop body returns, so it must not be retained;
+// breaking out of the loop closes the cursor early.
+//
+//	for batch, err := range df.Filter(...).Batches(4096) {
+//		if err != nil { ... }
+//		process(batch)
+//	}
+func (df *DataFrame) Batches(maxRows int) iter.Seq2[*ArrowBatch, error] {
+	return df.BatchesWithOptions(maxRows, CollectOptions{})
+}
+
+// BatchesWithOptions is Batches with explicit collect options (e.g. Streaming)
+func (df *DataFrame) BatchesWithOptions(maxRows int, opts CollectOptions) iter.Seq2[*ArrowBatch, error] {
+	return func(yield func(*ArrowBatch, error) bool) {
+		cursor, err := df.Cursor(opts)
+		if err != nil {
+			yield(nil, err)
+			return
+		}
+		defer cursor.Close()
+
+		for {
+			batch, err := cursor.Next(maxRows)
+			if err != nil {
+				yield(nil, err)
+				return
+			}
+			if batch == nil {
+				return
+			}
+
+			more := yield(batch, nil)
+			batch.Release()
+			if !more {
+				return
+			}
+		}
+	}
+}
@@ -0,0 +1,91 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestBatchCursor verifies results can be consumed as a sequence of Arrow batches
+func TestBatchCursor(t *testing.T) {
+	t.Run("BatchSizes", func(t *testing.T) {
+		var sizes []int
+		var ages []int64
+		for batch, err := range ReadCSV("../testdata/sample.csv").Select("age").Batches(3) {
+			require.NoError(t, err)
+			sizes = append(sizes, batch.NumRows())
+
+			values, err := ArrowValues[int64](batch.Column(0))
+			require.NoError(t, err)
+			ages = append(ages, values...) // Copied out before the batch is released
+		}
+
+		require.Equal(t, []int{3, 3, 1}, sizes)
+		require.Equal(t, []int64{25, 30, 35, 28, 32, 29, 27}, ages)
+	})
+
+	t.Run("StreamingFilter", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Engineering"))).
+			Select("name")
+
+		var sizes []int
+		for batch, err := range df.BatchesWithOptions(2, CollectOptions{Streaming: true}) {
+			require.NoError(t, err)
+			require.Equal(t, "name", batch.Column(0).Name())
+			sizes = append(sizes, batch.NumRows())
+		}
+		require.Equal(t, []int{2, 1}, sizes)
+	})
+
+	t.Run("EarlyBreak", func(t *testing.T) {
+		count := 0
+		for _, err := range ReadCSV("../testdata/sample.csv").Batches(1) {
+			require.NoError(t, err)
+			count++
+			if count == 2 {
+				break
+			}
+		}
+		require.Equal(t, 2, count)
+	})
+
+	t.Run("ExplicitCursor", func(t *testing.T) {
+		cursor, err := ReadCSV("../testdata/sample.csv").Cursor(CollectOptions{})
+		require.NoError(t, err)
+		defer cursor.Close()
+
+		batch, err := cursor.Next(5)
+		require.NoError(t, err)
+		require.Equal(t, 5, batch.NumRows())
+		require.Equal(t, 4, batch.NumColumns())
+
+		// Batches stay valid after the cursor moves on
+		rest, err := cursor.Next(5)
+		require.NoError(t, err)
+		require.Equal(t, 2, rest.NumRows())
+		require.Equal(t, "name", batch.Column(0).Name())
+		batch.Release()
+		rest.Release()
+
+		done, err := cursor.Next(5)
+		require.NoError(t, err)
+		require.Nil(t, done)
+	})
+
+	t.Run("GroupByWithoutAgg", func(t *testing.T) {
+		for _, err := range ReadCSV("../testdata/sample.csv").GroupBy("department").Batches(10) {
+			require.Error(t, err)
+			require.Contains(t, err.Error(), "Call agg() first")
+		}
+	})
+
+	t.Run("InvalidBatchSize", func(t *testing.T) {
+		cursor, err := ReadCSV("../testdata/sample.csv").Cursor(CollectOptions{})
+		require.NoError(t, err)
+		defer cursor.Close()
+
+		_, err = cursor.Next(0)
+		require.Error(t, err)
+	})
+}
@@ -7,6 +7,7 @@ import "C"
 import (
 	"errors"
 	"fmt"
+	"slices"
 	"unsafe"
 )
 
@@ -23,9 +24,18 @@ func makeRawStr(s string) C.RawStr {
 
 // Operation represents a single DataFrame operation with opcode and args
 type Operation struct {
-	opcode uint32                // OpCode for the operation
-	args   func() unsafe.Pointer // Lazy args allocation via closure (keeps references alive naturally)
-	err    error                 // Error associated with this operation (if any)
+	opcode uint32                         // OpCode for the operation
+	args   func(*argArena) unsafe.Pointer // Lazy args allocation into the execution's arena
+	err    error                          // Error associated with this operation (if any)
+
+	// Runs when the chain is built for execution, before any args are encoded;
+	// handles it produces are registered on the arena (e.g. Concat's pending inputs)
+	prepare func(*argArena) error
+
+	// Expression ops only: structural key (opcode plus args) and operand count,
+	// used to find repeated subexpressions. "" marks an op that is never shared.
+	key   string
+	arity uint8
 }
 
 // Helper functions for creating error operations
@@ -84,7 +94,7 @@ func (e *Error) Error() string {
 func NewDataFrame() *DataFrame {
 	op := Operation{
 		opcode: OpNewEmpty,
-		args:   func() unsafe.Pointer { return unsafe.Pointer(&C.CountArgs{}) }, // Lazy allocation
+		args:   func(a *argArena) unsafe.Pointer { return arenaNew(a, C.CountArgs{}) }, // Lazy allocation
 	}
 	
 	return &DataFrame{
@@ -93,22 +103,66 @@ func NewDataFrame() *DataFrame {
 	}
 }
 
+// CsvOptions configures CSV reading options
+type CsvOptions struct {
+	HasHeader bool // Whether the first row is a header
+	WithGlob  bool // Whether to expand glob patterns like "logs_*.csv"
+
+	Schema          []ColumnType // Full schema in column order; disables inference (nil = infer)
+	SchemaOverrides []ColumnType // Override inferred dtypes for some columns (e.g. Categorical)
+
+	InferSchemaLength int  // Rows used for inference (0 = Polars default of 100, -1 = all rows)
+	Separator         byte // Field separator (0 = ',')
+	QuoteChar         byte // Quote character (0 = '"')
+	DisableQuoting    bool // Treat quote characters as regular data
+
+	NRows     int  // Stop after this many rows (0 = all rows)
+	SkipRows  int  // Lines to skip before the header/data
+	LowMemory bool // Reduce memory pressure at the expense of speed
+	Rechunk   bool // Rechunk into contiguous memory after reading
+	ChunkSize int  // Rows per parallel parsing chunk (0 = Polars default)
+}
+
 // ReadCSV creates a DataFrame from a CSV file with default options
-// - has_header: true (assumes CSV has header row)
-// - with_glob: true (enables glob pattern expansion for paths like "data_*.csv")
+// - has_header: true
+// - with_glob: true
+// - schema: inferred from the first 100 rows
 func ReadCSV(path string) *DataFrame {
-	return ReadCSVWithOptions(path, true, true)
+	return ReadCSVWithOptions(path, CsvOptions{
+		HasHeader: true,
+		WithGlob:  true,
+	})
 }
 
 // ReadCSVWithOptions creates a DataFrame from a CSV file with configurable options
-func ReadCSVWithOptions(path string, hasHeader bool, withGlob bool) *DataFrame {
+func ReadCSVWithOptions(path string, options CsvOptions) *DataFrame {
+	if options.NRows < 0 || options.SkipRows < 0 || options.ChunkSize < 0 || options.InferSchemaLength < -1 {
+		return &DataFrame{operations: []Operation{errOp("ReadCSVWithOptions: invalid negative option")}}
+	}
+
 	op := Operation{
 		opcode: OpReadCsv,
-		args: func() unsafe.Pointer {
-			return unsafe.Pointer(&C.ReadCsvArgs{
-				path:       makeRawStr(path), // path captured by closure
-				has_header: C.bool(hasHeader),
-				with_glob:  C.bool(withGlob),
+		args: func(a *argArena) unsafe.Pointer {
+			schema := makeSchemaFields(a, options.Schema)
+			overrides := makeSchemaFields(a, options.SchemaOverrides)
+
+			return arenaNew(a, C.ReadCsvArgs{
+				path:                 a.rawStr(path),
+				has_header:           C.bool(options.HasHeader),
+				with_glob:            C.bool(options.WithGlob),
+				schema:               schema,
+				schema_count:         C.size_t(len(options.Schema)),
+				dtype_overrides:      overrides,
+				dtype_override_count: C.size_t(len(options.SchemaOverrides)),
+				infer_schema_length:  C.int64_t(options.InferSchemaLength),
+				separator:            C.uint8_t(options.Separator),
+				quote_char:           C.uint8_t(options.QuoteChar),
+				disable_quoting:      C.bool(options.DisableQuoting),
+				n_rows:               C.size_t(options.NRows),
+				skip_rows:            C.size_t(options.SkipRows),
+				low_memory:           C.bool(options.LowMemory),
+				rechunk:              C.bool(options.Rechunk),
+				chunk_size:           C.size_t(options.ChunkSize),
 			})
 		},
 	}
@@ -119,12 +173,48 @@ func ReadCSVWithOptions(path string, hasHeader bool, withGlob bool) *DataFrame {
 	}
 }
 
+// makeSchemaFields converts column types into a C SchemaField array (nil when empty)
+func makeSchemaFields(a *argArena, columns []ColumnType) *C.SchemaField {
+	if len(columns) == 0 {
+		return nil
+	}
+	fields := arenaSlice[C.SchemaField](a, len(columns))
+	for i, column := range columns {
+		fields[i] = C.SchemaField{
+			name:  a.rawStr(column.Name),
+			dtype: C.uint32_t(column.Type),
+		}
+	}
+	return &fields[0]
+}
+
+// HivePartitioning controls parsing of hive-style partition directories (key=value/)
+type HivePartitioning uint32
+
+const (
+	HivePartitioningAuto     HivePartitioning = 0 // Enabled when scanning a directory
+	HivePartitioningDisabled HivePartitioning = 1
+	HivePartitioningEnabled  HivePartitioning = 2
+)
+
 // ParquetOptions configures Parquet reading options
+// All options are honored together; Columns becomes a projection pushed into the reader.
+// Optimizations that Polars enables by default are opted out of, so zero fields keep them.
 type ParquetOptions struct {
 	Columns  []string // Optional column selection (nil = all columns)
 	NRows    int      // Optional row limit (0 = all rows)
 	Parallel bool     // Enable parallel reading
 	WithGlob bool     // Whether to expand glob patterns
+
+	DisableStatistics      bool             // Read every row group instead of pruning by min/max statistics
+	HivePartitioning       HivePartitioning // Expose partition directories as columns
+	DisableHiveDateParsing bool             // Keep date/datetime partition values as strings
+	LowMemory              bool             // Reduce memory pressure at the expense of speed
+	DisableCache           bool             // Rescan instead of caching a scan the plan reads more than once
+	Rechunk                bool             // Rechunk into contiguous memory after reading
+
+	RowIndexName   string // Add a row index column with this name ("" = none)
+	RowIndexOffset int    // Starting value of the row index
 }
 
 // ReadParquet creates a DataFrame from a Parquet file with default options
@@ -132,41 +222,43 @@ type ParquetOptions struct {
 // - n_rows: all rows (no limit)
 // - parallel: true (enables parallel reading)
 // - with_glob: true (enables glob pattern expansion for paths like "data_*.parquet")
+// - use_statistics: true (row-group pruning)
+// - hive_partitioning: auto
+// - cache: true
 func ReadParquet(path string) *DataFrame {
 	return ReadParquetWithOptions(path, ParquetOptions{
-		Columns:  nil,
-		NRows:    0,
-		Parallel: true,
-		WithGlob: true,
+		Columns:          nil,
+		NRows:            0,
+		Parallel:         true,
+		WithGlob:         true,
+		HivePartitioning: HivePartitioningAuto,
 	})
 }
 
 // ReadParquetWithOptions creates a DataFrame from a Parquet file with configurable options
 func ReadParquetWithOptions(path string, options ParquetOptions) *DataFrame {
+	if options.NRows < 0 || options.RowIndexOffset < 0 {
+		return &DataFrame{operations: []Operation{errOp("ReadParquetWithOptions: NRows and RowIndexOffset must be non-negative")}}
+	}
+
 	op := Operation{
 		opcode: OpReadParquet,
-		args: func() unsafe.Pointer {
-			var columnsPtr *C.RawStr
-			var columnCount C.size_t
-			
-			// Handle column selection if specified
-			if len(options.Columns) > 0 {
-				// Create RawStr array for columns
-				rawStrs := make([]C.RawStr, len(options.Columns))
-				for i, col := range options.Columns {
-					rawStrs[i] = makeRawStr(col)
-				}
-				columnsPtr = &rawStrs[0]
-				columnCount = C.size_t(len(options.Columns))
-			}
-			
-			return unsafe.Pointer(&C.ReadParquetArgs{
-				path:         makeRawStr(path), // path captured by closure
-				columns:      columnsPtr,
-				column_count: columnCount,
-				n_rows:       C.size_t(options.NRows),
-				parallel:     C.bool(options.Parallel),
-				with_glob:    C.bool(options.WithGlob),
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.ReadParquetArgs{
+				path:                 a.rawStr(path),
+				columns:              a.rawStrs(options.Columns), // nil selects all columns
+				column_count:         C.size_t(len(options.Columns)),
+				n_rows:               C.size_t(options.NRows),
+				parallel:             C.bool(options.Parallel),
+				with_glob:            C.bool(options.WithGlob),
+				use_statistics:       C.bool(!options.DisableStatistics),
+				hive_partitioning:    C.uint32_t(options.HivePartitioning),
+				try_parse_hive_dates: C.bool(!options.DisableHiveDateParsing),
+				low_memory:           C.bool(options.LowMemory),
+				cache:                C.bool(!options.DisableCache),
+				rechunk:              C.bool(options.Rechunk),
+				row_index_name:       a.rawStr(options.RowIndexName),
+				row_index_offset:     C.uint32_t(options.RowIndexOffset),
 			})
 		},
 	}
@@ -191,7 +283,62 @@ func (df *DataFrame) Collect() (*DataFrame, error) {
 	return df.execute()
 }
 
+// CollectOptions controls how Collect materializes a lazy plan
+type CollectOptions struct {
+	// Streaming runs the plan on the Polars streaming engine, processing the
+	// input in morsels instead of loading it fully into memory. The morsel size is
+	// process-wide: set POLARS_STREAMING_CHUNK_SIZE in the environment before start.
+	Streaming bool
+
+	// Optimizer toggles - every pass is enabled by default. Disabling one is
+	// mostly useful to compare plans with Explain or to work around an optimizer issue.
+	DisablePredicatePushdown  bool
+	DisableProjectionPushdown bool
+	DisableSlicePushdown      bool
+	DisableCSE                bool // Common subplan and subexpression elimination
+}
+
+// CollectWithOptions materializes the result like Collect, using the given engine options
+func (df *DataFrame) CollectWithOptions(opts CollectOptions) (*DataFrame, error) {
+	df.operations = append(df.operations, collectOperation(opts))
+	return df.execute()
+}
+
+// collectOperation builds a Collect operation carrying CollectArgs
+func collectOperation(opts CollectOptions) Operation {
+	return Operation{
+		opcode: OpCollect,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, opts.collectArgs())
+		},
+	}
+}
+
+// collectArgs converts the options to their C representation
+func (opts CollectOptions) collectArgs() C.CollectArgs {
+	return C.CollectArgs{
+		streaming:                   C.bool(opts.Streaming),
+		disable_predicate_pushdown:  C.bool(opts.DisablePredicatePushdown),
+		disable_projection_pushdown: C.bool(opts.DisableProjectionPushdown),
+		disable_slice_pushdown:      C.bool(opts.DisableSlicePushdown),
+		disable_cse:                 C.bool(opts.DisableCSE),
+	}
+}
+
+// CollectStreaming materializes the result on the streaming engine
+// Use this for inputs larger than memory; operations the streaming engine does
+// not support fall back to in-memory execution transparently.
+func (df *DataFrame) CollectStreaming() (*DataFrame, error) {
+	return df.CollectWithOptions(CollectOptions{Streaming: true})
+}
+
 func (df *DataFrame) execute() (*DataFrame, error) {
+	return df.executeWith(nil)
+}
+
+// executeWith runs the pending operations, honoring cancellation and deadline
+// options when they are given (nil = uninterruptible)
+func (df *DataFrame) executeWith(options *C.ExecutionOptions) (*DataFrame, error) {
 	if len(df.operations) == 0 {
 		return nil, errors.New("no operations to execute")
 	}
@@ -205,45 +352,32 @@ func (df *DataFrame) execute() (*DataFrame, error) {
 		df.operations = df.operations[:0]
 	}()
 	
-	// Convert Go operations to C operations, checking for errors
-	cOps := make([]C.Operation, len(df.operations))
-	for i, op := range df.operations {
-		// Check if this operation has an error
-		if op.err != nil {
-			return nil, &Error{
-				Code:    4, // ERROR_POLARS_OPERATION
-				Message: op.err.Error(),
-				Frame:   i,
-			}
-		}
-		
-		// Call the args function to get the actual args (lazy allocation)
-		var argsPtr unsafe.Pointer
-		if op.args != nil {
-			argsPtr = op.args() // Direct unsafe.Pointer, no type switch needed!
-		}
-		
-		cOps[i] = C.Operation{
-			opcode: C.uint32_t(op.opcode),
-			args:   C.uintptr_t(uintptr(argsPtr)),
-		}
+	arena := &argArena{}
+	defer arena.free()
+	cOps, err := df.buildOperations(arena)
+	if err != nil {
+		return nil, err
 	}
 	
 	// Single FFI call with the entire operation array
-	result := C.execute_operations(
-		df.handle, // Pass the full PolarsHandle with context
-		&cOps[0],
-		C.size_t(len(cOps)),
-	)
-	
-	if result.error_code != 0 {
-		errorMsg := C.GoString(result.error_message)
-		C.free_string(result.error_message)
-		return nil, &Error{
-			Code:    int(result.error_code),
-			Message: errorMsg,
-			Frame:   int(result.error_frame),
-		}
+	var result C.FfiResult
+	if options == nil {
+		result = C.execute_operations(
+			df.handle, // Pass the full PolarsHandle with context
+			&cOps[0],
+			C.size_t(len(cOps)),
+		)
+	} else {
+		result = C.execute_operations_with_options(df.handle, &cOps[0], C.size_t(len(cOps)), options)
+	}
+	
+	return df.adopt(result, oldHandle)
+}
+
+// adopt takes the handle produced by an execution, releasing the handle it replaces
+func (df *DataFrame) adopt(result C.FfiResult, oldHandle C.uintptr_t) (*DataFrame, error) {
+	if err := resultError(result); err != nil {
+		return nil, err
 	}
 	
 	// Update this DataFrame's handle to the new one
@@ -264,6 +398,55 @@ func (df *DataFrame) execute() (*DataFrame, error) {
 	return df, nil
 }
 
+// buildOperations converts Go operations to C operations in the arena, checking for errors
+// Operations are validated while repeated subexpressions are collected; the first
+// failing op stops the build before any args are encoded or anything reaches Rust.
+func (df *DataFrame) buildOperations(a *argArena) ([]C.Operation, error) {
+	ops, err := shareSubexpressions(df.operations)
+	if err != nil {
+		return nil, err
+	}
+	for i, op := range df.operations {
+		if op.prepare == nil {
+			continue
+		}
+		if err := op.prepare(a); err != nil {
+			return nil, &Error{Code: 4, Message: err.Error(), Frame: i} // ERROR_POLARS_OPERATION
+		}
+	}
+	cOps := arenaSlice[C.Operation](a, len(ops))
+	for i, op := range ops {
+		cOps[i] = op.encode(a)
+	}
+	return cOps, nil
+}
+
+// encode allocates the op's args in the arena and returns its C representation
+func (op Operation) encode(a *argArena) C.Operation {
+	var argsPtr unsafe.Pointer
+	if op.args != nil {
+		argsPtr = op.args(a)
+	}
+	return C.Operation{
+		opcode: C.uint32_t(op.opcode),
+		args:   C.uintptr_t(uintptr(argsPtr)),
+	}
+}
+
+// resultError converts a failed FfiResult into an *Error, freeing the Rust error message
+func resultError(result C.FfiResult) error {
+	if result.error_code == 0 {
+		return nil
+	}
+	errorMsg := C.GoString(result.error_message)
+	C.free_string(result.error_message)
+	return &Error{
+		Code:    int(result.error_code),
+		Message: errorMsg,
+		Frame:   int(result.error_frame),
+	}
+}
+
 // Select adds a select operation to the DataFrame using expressions or column names
 // Strings are automatically converted to SQL expressions, ExprNodes are used as-is
 // Example: df.Select("name", "salary * 1.1 as bonus", Col("age").Alias("years"))
@@ -312,7 +495,7 @@ func (df *DataFrame) SelectExpr(exprs ...*ExprNode) *DataFrame {
 func (df *DataFrame) Count() *DataFrame {
 	op := Operation{
 		opcode: OpCount,
-		args:   func() unsafe.Pointer { return unsafe.Pointer(&C.CountArgs{}) }, // Lazy allocation
+		args:   func(a *argArena) unsafe.Pointer { return arenaNew(a, C.CountArgs{}) }, // Lazy allocation
 	}
 	
 	df.operations = append(df.operations, op)
@@ -330,34 +513,93 @@ func (df *DataFrame) Height() (int, error) {
 	return int(height), nil
 }
 
-// Concat concatenates multiple executed DataFrames vertically (union)
-// All DataFrames must be executed before calling this function
+// ConcatMode selects how Concat lines up the columns of its inputs
+type ConcatMode = C.ConcatMode
+
+const (
+	ConcatVertical        = C.ConcatModeVertical        // Same columns in the same order and types
+	ConcatVerticalRelaxed = C.ConcatModeVerticalRelaxed // Same columns, types cast to their common supertype
+	ConcatDiagonal        = C.ConcatModeDiagonal        // Union of the columns, missing ones filled with nulls
+	ConcatDiagonalRelaxed = C.ConcatModeDiagonalRelaxed // Diagonal, types cast to their common supertype
+)
+
+// ConcatOptions controls ConcatWithOptions
+type ConcatOptions struct {
+	Mode       ConcatMode // Column alignment (default ConcatVertical)
+	Sequential bool       // Run the input plans one after another instead of in parallel
+}
+
+// Concat concatenates multiple DataFrames vertically (union)
+// See ConcatWithOptions.
 func Concat(dataframes ...*DataFrame) *DataFrame {
+	return ConcatWithOptions(ConcatOptions{}, dataframes...)
+}
+
+// ConcatWithOptions concatenates multiple DataFrames (union) into a lazy result
+// Inputs may be executed DataFrames or pending pipelines such as ReadParquet scans.
+// Pending inputs are snapshotted and only built when the concat itself executes,
+// so the inputs are left untouched (still pending, still owned by the caller) and
+// their errors surface from that execution. Executed inputs, and the handles that
+// pending inputs start from, must stay alive until then. Nothing is materialized
+// until the result is collected, and a filter or projection after the concat is
+// pushed down into every input plan - e.g. into the row-group pruning of each
+// Parquet scan.
+func ConcatWithOptions(opts ConcatOptions, dataframes ...*DataFrame) *DataFrame {
 	if len(dataframes) == 0 {
 		return NewDataFrame() // Return empty DataFrame
 	}
+	if opts.Mode > ConcatDiagonalRelaxed {
+		return &DataFrame{operations: []Operation{errOpf("Concat: invalid mode %d", opts.Mode)}}
+	}
+
+	// Snapshot pending inputs; prepare builds their plans when the concat executes
+	pending := make([]*DataFrame, len(dataframes))
+	built := make([]C.uintptr_t, len(dataframes))
+	for i, df := range dataframes {
+		if df == nil {
+			return &DataFrame{operations: []Operation{errOpf("Concat: input %d is nil", i)}}
+		}
+		if len(df.operations) > 0 {
+			pending[i] = &DataFrame{handle: df.handle, operations: slices.Clone(df.operations)}
+		}
+	}
 	
 	// Create operation that will concatenate the DataFrames
 	op := Operation{
 		opcode: OpConcat,
-		args: func() unsafe.Pointer {
-			// Create array of handles
-			handles := make([]C.uintptr_t, len(dataframes))
+		args: func(a *argArena) unsafe.Pointer {
+			// Create array of handles; a null handle is reported by Rust
+			handles := arenaSlice[C.uintptr_t](a, len(dataframes))
 			for i, df := range dataframes {
-				if df.handle.handle == 0 {
-					// This will cause an error in Rust, which is what we want
-					handles[i] = 0
-				} else {
-					handles[i] = df.handle.handle
+				handles[i] = df.handle.handle
+				if pending[i] != nil {
+					handles[i] = built[i]
 				}
 			}
 			
-			return unsafe.Pointer(&C.ConcatArgs{
-				handles: (*C.uintptr_t)(unsafe.Pointer(&handles[0])),
-				count:   C.size_t(len(handles)),
+			return arenaNew(a, C.ConcatArgs{
+				handles:  &handles[0],
+				count:    C.size_t(len(handles)),
+				how:      opts.Mode,
+				parallel: C.bool(!opts.Sequential),
 			})
 		},
 	}
+	if slices.ContainsFunc(pending, func(df *DataFrame) bool { return df != nil }) {
+		op.prepare = func(a *argArena) error {
+			for i, input := range pending {
+				if input == nil {
+					continue
+				}
+				handle, err := input.buildInput(a)
+				if err != nil {
+					return fmt.Errorf("Concat: input %d: %w", i, err)
+				}
+				built[i] = handle
+			}
+			return nil
+		}
+	}
 	
 	return &DataFrame{
 		handle:     C.PolarsHandle{handle: C.uintptr_t(0), context_type: C.uint32_t(0)}, // Lazy - no handle yet
@@ -365,6 +607,24 @@ func Concat(dataframes ...*DataFrame) *DataFrame {
 	}
 }
 
+// buildInput executes a copy of a pending input without collecting it
+// The lazy handle it produces belongs to the arena; the snapshot keeps its
+// operations, so the concat can be built again.
+func (df *DataFrame) buildInput(a *argArena) (C.uintptr_t, error) {
+	run := &DataFrame{handle: df.handle, operations: slices.Clone(df.operations)}
+	if run.handle.handle != 0 && C.retain_handle(run.handle.handle) != 0 { // adopt releases it
+		return 0, errors.New("invalid or released handle")
+	}
+	if _, err := run.execute(); err != nil {
+		if run.handle.handle != 0 {
+			C.release_dataframe(run.handle.handle)
+		}
+		return 0, err
+	}
+	a.own(run.handle.handle)
+	return run.handle.handle, nil
+}
+
 // WithColumns adds computed columns to the DataFrame while keeping existing columns
 // Strings are automatically converted to SQL expressions, ExprNodes are used as-is
 // Example: df.WithColumns("salary * 1.1 as bonus", Col("age").Alias("years"))
@@ -401,24 +661,20 @@ func (df *DataFrame) Filter(arg any) *DataFrame {
 	expr := exprs[0]
 	op := Operation{
 		opcode: OpFilterExpr,
-		args: func() unsafe.Pointer {
-			// Build C operation array directly from iterator (truly lazy!)
-			cOps := make([]C.Operation, 0, 4) // Start with capacity 4, grow as needed
-			
+		args: func(a *argArena) unsafe.Pointer {
+			// Count the expression ops first so the C array is a single arena allocation
+			count := 0
+			for range expr.ops {
+				count++
+			}
+			cOps := arenaSlice[C.Operation](a, count)
+			i := 0
 			for exprOp := range expr.ops {
-				// Call the expression's args function to get the actual args
-				var argsPtr unsafe.Pointer
-				if exprOp.args != nil {
-					argsPtr = exprOp.args() // Direct unsafe.Pointer, no type switch needed!
-				}
-				
-				cOps = append(cOps, C.Operation{
-					opcode: C.uint32_t(exprOp.opcode),
-					args:   C.uintptr_t(uintptr(argsPtr)),
-				})
+				cOps[i] = exprOp.encode(a)
+				i++
 			}
 			
-			return unsafe.Pointer(&C.FilterExprArgs{
+			return arenaNew(a, C.FilterExprArgs{
 				expr_ops:   &cOps[0],
 				expr_count: C.size_t(len(cOps)),
 			})
@@ -443,7 +699,15 @@ func (df *DataFrame) GroupBy(args ...any) *DataFrame {
 		return df.appendErrOp("GroupBy() requires at least one expression")
 	}
 	
-	exprs := toExprNodes(args...)
+	return df.groupBy(args, Operation{
+		opcode: OpGroupBy,
+		args:   noArgs,
+	})
+}
+
+// groupBy appends the group key expressions followed by a grouping operation
+func (df *DataFrame) groupBy(keys []any, op Operation) *DataFrame {
+	exprs := toExprNodes(keys...)
 	
 	// Add all expression operations first
 	for _, expr := range exprs {
@@ -454,11 +718,8 @@ func (df *DataFrame) GroupBy(args ...any) *DataFrame {
 		expr.consume()
 	}
 	
-	// Add the group_by operation
-	df.operations = append(df.operations, Operation{
-		opcode: OpGroupBy,
-		args:   noArgs,
-	})
+	// Add the grouping operation (consumes ALL expressions from the stack)
+	df.operations = append(df.operations, op)
 	
 	return df
 }
@@ -517,22 +778,18 @@ func (df *DataFrame) SortBy(fields []SortField) *DataFrame {
 	
 	op := Operation{
 		opcode: OpSort,
-		args: func() unsafe.Pointer {
+		args: func(a *argArena) unsafe.Pointer {
 			// Convert SortField slice to C array
-			cFields := make([]C.SortField, len(fields))
+			cFields := arenaSlice[C.SortField](a, len(fields))
 			for i, field := range fields {
-				columnData := unsafe.StringData(field.Column)
 				cFields[i] = C.SortField{
-					column: C.RawStr{
-						data: (*C.char)(unsafe.Pointer(columnData)),
-						len:  C.size_t(len(field.Column)),
-					},
+					column:         a.rawStr(field.Column),
 					direction:      C.SortDirection(field.Direction),
 					nulls_ordering: C.NullsOrdering(field.NullsOrdering),
 				}
 			}
 			
-			return unsafe.Pointer(&C.SortArgs{
+			return arenaNew(a, C.SortArgs{
 				fields:      &cFields[0],
 				field_count: C.int(len(fields)),
 			})
@@ -551,8 +808,8 @@ func (df *DataFrame) Limit(n int) *DataFrame {
 	
 	op := Operation{
 		opcode: OpLimit,
-		args: func() unsafe.Pointer {
-			return unsafe.Pointer(&C.LimitArgs{
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.LimitArgs{
 				n: C.size_t(n),
 			})
 		},
@@ -573,6 +830,8 @@ func (df *DataFrame) addNullRowForTesting() *DataFrame {
 }
 
 // Release manually releases the DataFrame resources
+// Works for any context (DataFrame, LazyFrame or GroupBy); with shared handles the
+// frame itself is freed once the last holder releases it.
 func (df *DataFrame) Release() error {
 	if df.handle.handle == 0 {
 		return nil // Already released or never executed
@@ -587,6 +846,27 @@ func (df *DataFrame) Release() error {
 	return nil
 }
 
+// Share returns a second DataFrame holding a reference to the same executed frame
+// No data is copied. Each holder must call Release; operations added to one holder
+// do not affect the other.
+func (df *DataFrame) Share() (*DataFrame, error) {
+	if df.handle.handle == 0 {
+		return nil, errors.New("dataframe not executed - call Collect() first")
+	}
+
+	if C.retain_handle(df.handle.handle) != 0 {
+		return nil, errors.New("invalid or released handle")
+	}
+
+	return &DataFrame{handle: df.handle}, nil
+}
+
+// LiveHandles returns the number of frames currently held by the Rust side
+// Useful for detecting leaked handles in tests and long-running services.
+func LiveHandles() int {
+	return int(C.live_handle_count())
+}
+
 // ToCsv converts an executed DataFrame to a CSV string
 func (df *DataFrame) ToCsv() (string, error) {
 	if df.handle.handle == 0 {
@@ -623,16 +903,16 @@ func (df *DataFrame) String() string {
 }
 
 // Query executes a SQL query on the DataFrame
-// The DataFrame is registered as "df" table in the SQL context
+// The DataFrame is registered as "df" table in the SQL context, next to any
+// tables added with RegisterTable
 // Example: df.Query("SELECT name, salary * 1.1 as new_salary FROM df WHERE age > 25")
 func (df *DataFrame) Query(sql string) *DataFrame {
 	op := Operation{
 		opcode: OpQuery,
-		args: func() unsafe.Pointer {
-			args := &C.QueryArgs{
-				sql: makeRawStr(sql),
-			}
-			return unsafe.Pointer(args)
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.QueryArgs{
+				sql: a.rawStr(sql),
+			})
 		},
 	}
 	
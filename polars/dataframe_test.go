@@ -2,6 +2,7 @@ package polars
 
 import (
 	"os"
+	"path/filepath"
 	"testing"
 	"time"
 
@@ -660,7 +661,7 @@ func TestPerformanceBenchmarks(t *testing.T) {
 		}
 
 		// Load all 10 files from scripts/testdata (100M rows total) using glob pattern
-		df := ReadCSVWithOptions("../scripts/testdata/weather_data_part_*.csv", true, true)
+		df := ReadCSVWithOptions("../scripts/testdata/weather_data_part_*.csv", CsvOptions{HasHeader: true, WithGlob: true})
 
 		// Test complex aggregation on 100M rows
 		start := time.Now()
@@ -702,7 +703,7 @@ func TestPerformanceBenchmarks(t *testing.T) {
 		}
 
 		// Test with filter that matches nothing (impossible temperatures)
-		df := ReadCSVWithOptions("../scripts/testdata/weather_data_part_*.csv", true, true)
+		df := ReadCSVWithOptions("../scripts/testdata/weather_data_part_*.csv", CsvOptions{HasHeader: true, WithGlob: true})
 
 		start := time.Now()
 		result, err := df.Filter(
@@ -1016,6 +1017,139 @@ func TestJoinOperations(t *testing.T) {
 
 		require.Equal(t, expected, result.String())
 	})
+
+	t.Run("SemiAndAntiJoin", func(t *testing.T) {
+		left, err := ReadCSV("../testdata/sample.csv").Select("name", "department").Collect()
+		require.NoError(t, err)
+		defer left.Release()
+
+		engineers, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Engineering"))).
+			Select("name").
+			Collect()
+		require.NoError(t, err)
+		defer engineers.Release()
+
+		// Semi join keeps matching left rows and adds no right columns
+		semi, err := left.Share()
+		require.NoError(t, err)
+		result, err := semi.SemiJoin(engineers, "name").Sort([]string{"name"}).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (3, 2)
+┌─────────┬─────────────┐
+│ name    ┆ department  │
+│ ---     ┆ ---         │
+│ str     ┆ str         │
+╞═════════╪═════════════╡
+│ Alice   ┆ Engineering │
+│ Charlie ┆ Engineering │
+│ Eve     ┆ Engineering │
+└─────────┴─────────────┘`
+		require.Equal(t, expected, result.String())
+
+		anti, err := left.Share()
+		require.NoError(t, err)
+		others, err := anti.AntiJoin(engineers, "name").Collect()
+		require.NoError(t, err)
+		defer others.Release()
+
+		height, err := others.Height()
+		require.NoError(t, err)
+		require.Equal(t, 4, height)
+	})
+
+	t.Run("JoinValidation", func(t *testing.T) {
+		left, err := ReadCSV("../testdata/sample.csv").Select("name", "department").Collect()
+		require.NoError(t, err)
+		defer left.Release()
+
+		departments, err := ReadCSV("../testdata/sample.csv").Select("department", "age").Collect()
+		require.NoError(t, err)
+		defer departments.Release()
+
+		// Department keys repeat on the right, so many-to-one fails
+		_, err = left.Join(departments, On("department").WithValidation(JoinValidateManyToOne)).Collect()
+		require.Error(t, err)
+	})
+
+	t.Run("SortedKeys", func(t *testing.T) {
+		left, err := ReadCSV("../testdata/sample.csv").Select("name", "age").Sort([]string{"age"}).Collect()
+		require.NoError(t, err)
+		defer left.Release()
+
+		right, err := ReadCSV("../testdata/sample.csv").Select("age", "salary").Sort([]string{"age"}).Collect()
+		require.NoError(t, err)
+		defer right.Release()
+
+		result, err := left.Join(right, On("age").WithSortedKeys()).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 7, height)
+	})
+
+	t.Run("SortedLeadingKey", func(t *testing.T) {
+		// Only department is sorted on its own; age is sorted within each department
+		byDepartment := []string{"department", "age"}
+		left, err := ReadCSV("../testdata/sample.csv").Select("department", "age", "name").Sort(byDepartment).Collect()
+		require.NoError(t, err)
+		defer left.Release()
+
+		right, err := ReadCSV("../testdata/sample.csv").Select("department", "age", "salary").Sort(byDepartment).Collect()
+		require.NoError(t, err)
+		defer right.Release()
+
+		result, err := left.Join(right, On("department", "age").WithSortedKeys()).
+			Sort([]string{"age"}).
+			Select("age").
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		csv, err := result.ToCsv()
+		require.NoError(t, err)
+		require.Equal(t, "age\n25\n27\n28\n29\n30\n32\n35\n", csv)
+	})
+
+	t.Run("AsofJoin", func(t *testing.T) {
+		left, err := ReadCSV("../testdata/sample.csv").Select("name", "age").Sort([]string{"age"}).Collect()
+		require.NoError(t, err)
+		defer left.Release()
+
+		// Engineering ages: 25 (Alice), 32 (Eve), 35 (Charlie)
+		right, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Engineering"))).
+			Select("name as eng_name", "age as eng_age").
+			Sort([]string{"eng_age"}).
+			Collect()
+		require.NoError(t, err)
+		defer right.Release()
+
+		// Latest engineer at or below each age, at most 2 years apart
+		result, err := left.JoinAsof(right, "age", "eng_age", AsofOptions{Tolerance: "2"}).
+			Filter("eng_name IS NOT NULL").
+			Select("name", "eng_name").
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (4, 2)
+┌─────────┬──────────┐
+│ name    ┆ eng_name │
+│ ---     ┆ ---      │
+│ str     ┆ str      │
+╞═════════╪══════════╡
+│ Alice   ┆ Alice    │
+│ Grace   ┆ Alice    │
+│ Eve     ┆ Eve      │
+│ Charlie ┆ Charlie  │
+└─────────┴──────────┘`
+		require.Equal(t, expected, result.String())
+	})
 }
 
 // TestParquetOperations demonstrates Parquet file reading capabilities focused on Firn integration
@@ -1106,6 +1240,71 @@ func TestParquetOperations(t *testing.T) {
 		require.Equal(t, expected, result.String())
 	})
 
+	t.Run("ColumnsWithRowLimit", func(t *testing.T) {
+		// Column selection no longer drops NRows
+		df := ReadParquetWithOptions("../testdata/fortune1000_2024.parquet", ParquetOptions{
+			Columns:        []string{"Company"},
+			NRows:          2,
+			Parallel:       true,
+			DisableCache:   true,
+			RowIndexName:   "idx",
+			RowIndexOffset: 10,
+		})
+		result, err := df.Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 2)
+┌─────┬─────────┐
+│ idx ┆ Company │
+│ --- ┆ ---     │
+│ u32 ┆ str     │
+╞═════╪═════════╡
+│ 10  ┆ Walmart │
+│ 11  ┆ Amazon  │
+└─────┴─────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("HivePartitioning", func(t *testing.T) {
+		dir := t.TempDir()
+		for _, department := range []string{"Engineering", "Sales"} {
+			partition := filepath.Join(dir, "department="+department)
+			require.NoError(t, os.MkdirAll(partition, 0o755))
+			err := ReadCSV("../testdata/sample.csv").
+				Filter(Col("department").Eq(Lit(department))).
+				Select("name", "age").
+				SinkParquet(filepath.Join(partition, "data.parquet"))
+			require.NoError(t, err)
+		}
+
+		df := ReadParquetWithOptions(dir, ParquetOptions{
+			Parallel:         true,
+			WithGlob:         true,
+			HivePartitioning: HivePartitioningEnabled,
+		})
+		result, err := df.
+			Filter(Col("department").Eq(Lit("Sales"))).
+			Select("name", "department").
+			Sort([]string{"name"}).
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 2)
+┌───────┬────────────┐
+│ name  ┆ department │
+│ ---   ┆ ---        │
+│ str   ┆ str        │
+╞═══════╪════════════╡
+│ Diana ┆ Sales      │
+│ Grace ┆ Sales      │
+└───────┴────────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
 	t.Run("ParquetErrorHandling", func(t *testing.T) {
 		// Test error handling for invalid Parquet files
 		df := ReadParquet("../testdata/nonexistent.parquet")
@@ -1333,3 +1532,131 @@ func TestErrorHandling(t *testing.T) {
 		require.Contains(t, err.Error(), "polars error")
 	})
 }
+
+// TestStreamingCollect verifies the streaming engine produces the same results as in-memory collect
+func TestStreamingCollect(t *testing.T) {
+	t.Run("GroupByAgg", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		result, err := df.Filter(Col("age").Gt(Lit(26))).
+			GroupBy("department").
+			Agg(Col("salary").Sum()).
+			Sort([]string{"department"}).
+			CollectStreaming()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (3, 2)
+┌─────────────┬────────┐
+│ department  ┆ salary │
+│ ---         ┆ ---    │
+│ str         ┆ i64    │
+╞═════════════╪════════╡
+│ Engineering ┆ 135000 │
+│ Marketing   ┆ 118000 │
+│ Sales       ┆ 107000 │
+└─────────────┴────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("WithOptimizerToggles", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		result, err := df.Select("name", "salary").
+			CollectWithOptions(CollectOptions{Streaming: true, DisableSlicePushdown: true, DisableCSE: true})
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 7, height)
+	})
+}
+
+// TestCSVOptions verifies schema overrides and parsing options on ReadCSVWithOptions
+func TestCSVOptions(t *testing.T) {
+	t.Run("SchemaOverrides", func(t *testing.T) {
+		df := ReadCSVWithOptions("../testdata/sample.csv", CsvOptions{
+			HasHeader: true,
+			SchemaOverrides: []ColumnType{
+				{Name: "age", Type: Int32},
+				{Name: "department", Type: Categorical},
+			},
+			InferSchemaLength: 10,
+		})
+		result, err := df.Select("age", "department").Limit(2).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 2)
+┌─────┬─────────────┐
+│ age ┆ department  │
+│ --- ┆ ---         │
+│ i32 ┆ cat         │
+╞═════╪═════════════╡
+│ 25  ┆ Engineering │
+│ 30  ┆ Marketing   │
+└─────┴─────────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("FullSchemaWithoutHeader", func(t *testing.T) {
+		df := ReadCSVWithOptions("../testdata/sample.csv", CsvOptions{
+			HasHeader: false,
+			SkipRows:  1, // Skip the header line
+			NRows:     2,
+			Schema: []ColumnType{
+				{Name: "employee", Type: String},
+				{Name: "years", Type: Int16},
+				{Name: "pay", Type: Float64},
+				{Name: "team", Type: String},
+			},
+		})
+		result, err := df.Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 4)
+┌──────────┬───────┬─────────┬─────────────┐
+│ employee ┆ years ┆ pay     ┆ team        │
+│ ---      ┆ ---   ┆ ---     ┆ ---         │
+│ str      ┆ i16   ┆ f64     ┆ str         │
+╞══════════╪═══════╪═════════╪═════════════╡
+│ Alice    ┆ 25    ┆ 50000.0 ┆ Engineering │
+│ Bob      ┆ 30    ┆ 60000.0 ┆ Marketing   │
+└──────────┴───────┴─────────┴─────────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("ParsingOptions", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "semicolon.csv")
+		require.NoError(t, os.WriteFile(path, []byte("id;note\n1;'a;b'\n2;plain\n"), 0o644))
+
+		df := ReadCSVWithOptions(path, CsvOptions{
+			HasHeader: true,
+			Separator: ';',
+			QuoteChar: '\'',
+			LowMemory: true,
+			Rechunk:   true,
+			ChunkSize: 1,
+		})
+		result, err := df.Select("note").Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		csv, err := result.ToCsv()
+		require.NoError(t, err)
+		require.Equal(t, "note\na;b\nplain\n", csv)
+	})
+
+	t.Run("UnknownDataType", func(t *testing.T) {
+		df := ReadCSVWithOptions("../testdata/sample.csv", CsvOptions{
+			HasHeader:       true,
+			SchemaOverrides: []ColumnType{{Name: "age", Type: DataType(0xFFFF_0001)}},
+		})
+		_, err := df.Collect()
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "Unknown data type family")
+	})
+}
@@ -0,0 +1,47 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import "errors"
+
+// Explain returns the logical plan of the pending query
+// With optimized=false the plan is rendered as built; with optimized=true it shows
+// the plan Collect would run, after predicate/projection pushdown, CSE, etc.
+// Pending operations are executed first (without collecting), so the DataFrame
+// holds the resulting lazy handle afterwards.
+func (df *DataFrame) Explain(optimized bool) (string, error) {
+	return df.explain(optimized, nil)
+}
+
+// ExplainWithOptions returns the optimized plan under the optimizer toggles of opts
+// Use it to see what a CollectWithOptions call with the same options would run.
+func (df *DataFrame) ExplainWithOptions(opts CollectOptions) (string, error) {
+	args := opts.collectArgs()
+	return df.explain(true, &args)
+}
+
+func (df *DataFrame) explain(optimized bool, args *C.CollectArgs) (string, error) {
+	if len(df.operations) > 0 {
+		if _, err := df.execute(); err != nil {
+			return "", err
+		}
+	}
+	if df.handle.handle == 0 {
+		return "", errors.New("no operations to explain")
+	}
+
+	var out *C.char
+	code := C.explain_plan(df.handle.handle, C.bool(optimized), args, &out)
+	if out == nil {
+		return "", &Error{Code: int(code), Message: "failed to explain plan"}
+	}
+	defer C.free_string(out)
+
+	text := C.GoString(out)
+	if code != 0 {
+		return "", &Error{Code: int(code), Message: text}
+	}
+	return text, nil
+}
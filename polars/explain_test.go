@@ -0,0 +1,77 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestExplain verifies plan inspection and the optimizer toggles of CollectOptions
+func TestExplain(t *testing.T) {
+	t.Run("PredicatePushdown", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").Filter(Col("age").Gt(Lit(30)))
+		defer df.Release()
+
+		plan, err := df.Explain(false)
+		require.NoError(t, err)
+		require.Contains(t, plan, "FILTER")
+
+		// The optimizer folds the filter into the scan
+		optimized, err := df.Explain(true)
+		require.NoError(t, err)
+		require.NotContains(t, optimized, "FILTER")
+		require.Contains(t, optimized, "SELECTION")
+	})
+
+	t.Run("DisablePredicatePushdown", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").Filter(Col("age").Gt(Lit(30)))
+		defer df.Release()
+
+		opts := CollectOptions{DisablePredicatePushdown: true}
+		plan, err := df.ExplainWithOptions(opts)
+		require.NoError(t, err)
+		require.Contains(t, plan, "FILTER")
+
+		// Same result either way
+		result, err := df.CollectWithOptions(opts)
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 2, height)
+	})
+
+	t.Run("AllPassesDisabled", func(t *testing.T) {
+		result, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Lit(30))).
+			Select("name").
+			Limit(1).
+			CollectWithOptions(CollectOptions{
+				DisablePredicatePushdown:  true,
+				DisableProjectionPushdown: true,
+				DisableSlicePushdown:      true,
+				DisableCSE:                true,
+			})
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 1, height)
+	})
+
+	t.Run("GroupBy", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").GroupBy("department")
+		defer df.Release()
+
+		plan, err := df.Explain(false)
+		require.NoError(t, err)
+		require.Contains(t, plan, "department")
+	})
+
+	t.Run("NothingToExplain", func(t *testing.T) {
+		_, err := (&DataFrame{}).Explain(true)
+		require.Error(t, err)
+	})
+}
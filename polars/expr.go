@@ -7,12 +7,14 @@ import "C"
 import (
 	"fmt"
 	"iter"
+	"strconv"
 	"unsafe"
 )
 
 // ExprNode contains a lazy sequence of operations to build an expression
 type ExprNode struct {
 	ops iter.Seq[Operation] // Lazy iterator over operations - no allocation until consumed
+	lit any                 // Value of a literal-only expression, for constant folding (nil otherwise)
 }
 
 // ConditionalNode represents a conditional expression being built (When/Then/Otherwise)
@@ -81,9 +83,10 @@ func Col(name string) *ExprNode {
 		ops: func(yield func(Operation) bool) {
 			yield(Operation{
 				opcode: OpExprColumn,
-				args: func() unsafe.Pointer {
-					return unsafe.Pointer(&C.ColumnArgs{
-						name: makeRawStr(name), // name captured by closure, stays alive
+				key:    exprKey(OpExprColumn, strconv.Quote(name)),
+				args: func(a *argArena) unsafe.Pointer {
+					return arenaNew(a, C.ColumnArgs{
+						name: a.rawStr(name),
 					})
 				},
 			})
@@ -91,58 +94,64 @@ func Col(name string) *ExprNode {
 	}
 }
 
+// Lit creates a literal expression from an int, int64, float64, string or bool value
+// Lit(nil) is a null whose type follows the surrounding expression.
 func Lit(value interface{}) *ExprNode {
 	return &ExprNode{
+		lit: value,
 		ops: func(yield func(Operation) bool) {
 			yield(Operation{
 				opcode: OpExprLiteral,
-				args: func() unsafe.Pointer {
-					// Closure captures value, keeping it alive
-					switch v := value.(type) {
-					case int:
-						return unsafe.Pointer(&C.LiteralArgs{
-							literal: C.Literal{
-								value_type: 0,
-								int_value:  C.longlong(v),
-							},
-						})
-					case int64:
-						return unsafe.Pointer(&C.LiteralArgs{
-							literal: C.Literal{
-								value_type: 0,
-								int_value:  C.longlong(v),
-							},
-						})
-					case float64:
-						return unsafe.Pointer(&C.LiteralArgs{
-							literal: C.Literal{
-								value_type:  1,
-								float_value: C.double(v),
-							},
-						})
-					case string:
-						return unsafe.Pointer(&C.LiteralArgs{
-							literal: C.Literal{
-								value_type:   2,
-								string_value: makeRawStr(v), // v captured by closure
-							},
-						})
-					case bool:
-						return unsafe.Pointer(&C.LiteralArgs{
-							literal: C.Literal{
-								value_type: 3,
-								bool_value: C._Bool(v),
-							},
-						})
-					default:
+				key:    literalKey(value),
+				args: func(a *argArena) unsafe.Pointer {
+					literal, ok := makeLiteral(a, value)
+					if !ok {
 						panic(fmt.Sprintf("unsupported literal type: %T", value))
 					}
+					return arenaNew(a, C.LiteralArgs{literal: literal})
 				},
 			})
 		},
 	}
 }
 
+// makeLiteral converts a Go value to the C Literal struct, copying strings into the arena
+func makeLiteral(a *argArena, value interface{}) (C.Literal, bool) {
+	switch v := value.(type) {
+	case int:
+		return C.Literal{value_type: 0, int_value: C.longlong(v)}, true
+	case int64:
+		return C.Literal{value_type: 0, int_value: C.longlong(v)}, true
+	case float64:
+		return C.Literal{value_type: 1, float_value: C.double(v)}, true
+	case string:
+		return C.Literal{value_type: 2, string_value: a.rawStr(v)}, true
+	case bool:
+		return C.Literal{value_type: 3, bool_value: C._Bool(v)}, true
+	case nil:
+		return C.Literal{value_type: 4}, true
+	default:
+		return C.Literal{}, false
+	}
+}
+
+// Param creates a placeholder for a value bound at PreparedPlan.Execute time
+// Usage: df.Filter(Col("age").Gt(Param(0))).Prepare()
+func Param(index int) *ExprNode {
+	if index < 0 {
+		return &ExprNode{ops: single(errOp("Param() index must be non-negative"))}
+	}
+
+	return &ExprNode{
+		ops: single(Operation{
+			opcode: OpExprParam,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.ParamArgs{index: C.uint32_t(index)})
+			},
+		}),
+	}
+}
+
 // SqlExpr creates an ExprNode from a SQL expression string
 // Supports SQL expressions like "salary * 1.1", "(a + b) / c", "salary * 1.1 AS bonus_salary"
 // For supported SQL functions, see: https://docs.pola.rs/api/python/dev/reference/sql/functions/index.html
@@ -150,9 +159,10 @@ func SqlExpr(sql string) *ExprNode {
 	return &ExprNode{
 		ops: single(Operation{
 			opcode: OpExprSql,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.SqlExprArgs{
-					sql: makeRawStr(sql), // sql captured by closure, stays alive
+			key:    exprKey(OpExprSql, strconv.Quote(sql)),
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.SqlExprArgs{
+					sql: a.rawStr(sql),
 				})
 			},
 		}),
@@ -179,16 +189,26 @@ func toExprNodes(args ...any) []*ExprNode {
 	return exprs
 }
 
-func noArgs() unsafe.Pointer { return nil }
+func noArgs(*argArena) unsafe.Pointer { return nil }
 
 func binOp(left, right *ExprNode, opcode uint32) *ExprNode {
+	// Literal-only operands are evaluated here instead of shipping the arithmetic
+	if value, ok := foldBinary(opcode, left.lit, right.lit); ok {
+		right.consume()
+		*left = *Lit(value)
+		return left
+	}
+
 	// Combine left, right using opcode.
+	left.lit = nil
 	left.ops = combine(
 		left.ops,
 		right.consumeOps(),
 		single(Operation{
 			opcode: opcode,
 			args:   noArgs, // op takes no args - operates on expression stack
+			key:    exprKey(opcode, ""),
+			arity:  2,
 		}))
 	return left
 }
@@ -233,6 +253,9 @@ func (left *ExprNode) Or(right *ExprNode) *ExprNode {
 }
 
 func (expr *ExprNode) Not() *ExprNode {
+	if value, ok := expr.lit.(bool); ok {
+		return Lit(!value)
+	}
 	return expr.unaryOp(OpExprNot)
 }
 
@@ -291,8 +314,10 @@ func (expr *ExprNode) Count() *ExprNode {
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprCount,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.CountArgs{
+			key:    exprKey(OpExprCount, ""),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.CountArgs{
 					include_nulls: C.bool(false),
 				})
 			},
@@ -305,8 +330,10 @@ func (expr *ExprNode) CountWithNulls() *ExprNode {
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprCountNulls,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.CountArgs{
+			key:    exprKey(OpExprCountNulls, ""),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.CountArgs{
 					include_nulls: C.bool(true),
 				})
 			},
@@ -320,6 +347,8 @@ func (expr *ExprNode) unaryOp(opcode uint32) *ExprNode {
 		ops: combine(expr.ops, single(Operation{
 			opcode: opcode,
 			args:   noArgs,
+			key:    exprKey(opcode, ""),
+			arity:  1,
 		})),
 	}
 }
@@ -329,9 +358,11 @@ func (expr *ExprNode) unaryOpWithStringArgs(opcode uint32, pattern string) *Expr
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: opcode,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.StringArgs{
-					pattern: makeRawStr(pattern),
+			key:    exprKey(opcode, strconv.Quote(pattern)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.StringArgs{
+					pattern: a.rawStr(pattern),
 				})
 			},
 		})),
@@ -343,9 +374,11 @@ func (expr *ExprNode) unaryOpWithAliasArgs(opcode uint32, name string) *ExprNode
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: opcode,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.AliasArgs{
-					name: makeRawStr(name),
+			key:    exprKey(opcode, strconv.Quote(name)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.AliasArgs{
+					name: a.rawStr(name),
 				})
 			},
 		})),
@@ -369,8 +402,10 @@ func (expr *ExprNode) ddofAggregation(opcode uint32, opName string, ddof ...uint
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: opcode,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.AggregationArgs{ddof: C.uchar(ddofValue)})
+			key:    exprKey(opcode, strconv.Itoa(int(ddofValue))),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.AggregationArgs{ddof: C.uchar(ddofValue)})
 			},
 		})),
 	}
@@ -439,15 +474,9 @@ func (expr *ExprNode) Over(partitionColumns ...string) *ExprNode {
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprOver,
-			args: func() unsafe.Pointer {
-				// Closure captures partitionColumns, keeping them alive
-				rawColumns := make([]C.RawStr, len(partitionColumns))
-				for i, col := range partitionColumns {
-					rawColumns[i] = makeRawStr(col)
-				}
-				
-				return unsafe.Pointer(&C.WindowArgs{
-					partition_columns: &rawColumns[0],
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.WindowArgs{
+					partition_columns: a.rawStrs(partitionColumns),
 					partition_count:   C.int(len(partitionColumns)),
 					order_columns:     nil, // No ordering for basic Over()
 					order_count:       0,
@@ -470,22 +499,11 @@ func (expr *ExprNode) OverOrdered(partitionColumns []string, orderColumns []stri
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprOver,
-			args: func() unsafe.Pointer {
-				// Closure captures both column arrays, keeping them alive
-				rawPartitionColumns := make([]C.RawStr, len(partitionColumns))
-				for i, col := range partitionColumns {
-					rawPartitionColumns[i] = makeRawStr(col)
-				}
-				
-				rawOrderColumns := make([]C.RawStr, len(orderColumns))
-				for i, col := range orderColumns {
-					rawOrderColumns[i] = makeRawStr(col)
-				}
-				
-				return unsafe.Pointer(&C.WindowArgs{
-					partition_columns: &rawPartitionColumns[0],
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.WindowArgs{
+					partition_columns: a.rawStrs(partitionColumns),
 					partition_count:   C.int(len(partitionColumns)),
-					order_columns:     &rawOrderColumns[0],
+					order_columns:     a.rawStrs(orderColumns),
 					order_count:       C.int(len(orderColumns)),
 				})
 			},
@@ -540,8 +558,8 @@ func (expr *ExprNode) Lag(offset int) *ExprNode {
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprLag,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.WindowOffsetArgs{
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.WindowOffsetArgs{
 					offset: C.int(-offset), // Negative for looking back
 				})
 			},
@@ -560,8 +578,8 @@ func (expr *ExprNode) Lead(offset int) *ExprNode {
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprLead,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.WindowOffsetArgs{
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.WindowOffsetArgs{
 					offset: C.int(offset), // Positive for looking ahead
 				})
 			},
@@ -569,6 +587,166 @@ func (expr *ExprNode) Lead(offset int) *ExprNode {
 	}
 }
 
+// Rolling Aggregations
+
+// RollingWindow configures RollingSum, RollingMean, RollingMin, RollingMax and RollingStd
+// Set WindowSize for a window over the last N rows, or By and Duration for a time
+// window ending at each row of a sorted temporal column. Durations use the Polars
+// duration language ("30s", "1h", "7d").
+type RollingWindow struct {
+	WindowSize int          // Rows per window (fixed windows)
+	MinPeriods int          // Non-null values required for a result (0 = WindowSize, or 1 with By)
+	Center     bool         // Label fixed windows at their center instead of their last row
+	By         string       // Sorted temporal column for duration windows
+	Duration   string       // Window length with By
+	Closed     WindowClosed // Duration window edges (default right)
+}
+
+// RollingSum sums each window
+// Example: Col("sales").RollingSum(RollingWindow{WindowSize: 7}).Alias("weekly")
+func (expr *ExprNode) RollingSum(window RollingWindow) *ExprNode {
+	return expr.rolling(OpExprRollingSum, "RollingSum", window, 0)
+}
+
+// RollingMean averages each window
+func (expr *ExprNode) RollingMean(window RollingWindow) *ExprNode {
+	return expr.rolling(OpExprRollingMean, "RollingMean", window, 0)
+}
+
+// RollingMin takes the minimum of each window
+func (expr *ExprNode) RollingMin(window RollingWindow) *ExprNode {
+	return expr.rolling(OpExprRollingMin, "RollingMin", window, 0)
+}
+
+// RollingMax takes the maximum of each window
+func (expr *ExprNode) RollingMax(window RollingWindow) *ExprNode {
+	return expr.rolling(OpExprRollingMax, "RollingMax", window, 0)
+}
+
+// RollingStd takes the standard deviation of each window
+// ddof defaults to 0 (population) like Std; pass 1 for the sample deviation.
+func (expr *ExprNode) RollingStd(window RollingWindow, ddof ...uint8) *ExprNode {
+	if len(ddof) > 1 {
+		return &ExprNode{ops: combine(expr.ops, single(errOp("RollingStd() accepts at most one ddof parameter")))}
+	}
+	ddofValue := uint8(0)
+	if len(ddof) == 1 {
+		ddofValue = ddof[0]
+		if ddofValue != 0 && ddofValue != 1 {
+			return &ExprNode{ops: combine(expr.ops, single(errOp("ddof must be 0 (population) or 1 (sample)")))}
+		}
+	}
+	return expr.rolling(OpExprRollingStd, "RollingStd", window, ddofValue)
+}
+
+// rolling is the shared builder of the rolling aggregations
+func (expr *ExprNode) rolling(opcode uint32, opName string, window RollingWindow, ddof uint8) *ExprNode {
+	switch {
+	case window.By == "" && window.WindowSize <= 0:
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() requires a positive WindowSize, or By and Duration", opName)))}
+	case window.By != "" && window.Duration == "":
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() with By requires a Duration", opName)))}
+	case window.MinPeriods < 0:
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() MinPeriods cannot be negative", opName)))}
+	}
+
+	return &ExprNode{
+		ops: combine(expr.ops, single(Operation{
+			opcode: opcode,
+			key:    exprKey(opcode, fmt.Sprintf("%+v %d", window, ddof)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.RollingExprArgs{
+					window_size: C.size_t(max(window.WindowSize, 0)),
+					min_periods: C.size_t(window.MinPeriods),
+					center:      C.bool(window.Center),
+					ddof:        C.uint8_t(ddof),
+					by:          a.rawStr(window.By),
+					duration:    a.rawStr(window.Duration),
+					closed:      window.Closed,
+				})
+			},
+		})),
+	}
+}
+
+// Cumulative Aggregations
+
+// CumSum returns the running sum from the first row
+func (expr *ExprNode) CumSum() *ExprNode {
+	return expr.unaryOp(OpExprCumSum)
+}
+
+// CumMin returns the running minimum from the first row
+func (expr *ExprNode) CumMin() *ExprNode {
+	return expr.unaryOp(OpExprCumMin)
+}
+
+// CumMax returns the running maximum from the first row
+func (expr *ExprNode) CumMax() *ExprNode {
+	return expr.unaryOp(OpExprCumMax)
+}
+
+// Exponentially Weighted Statistics
+
+// EwmOptions configures EwmMean and EwmStd
+// Set either Alpha or Span; recent rows weigh (1 - alpha) times more than the row before.
+type EwmOptions struct {
+	Alpha       float64 // Smoothing factor in (0, 1]
+	Span        float64 // Alternative to Alpha: alpha = 2 / (Span + 1), Span >= 1
+	Adjust      bool    // Divide by the decaying weight sum, as pandas adjust=True
+	Bias        bool    // EwmStd without the bias correction
+	MinPeriods  int     // Values required before a result is produced
+	IgnoreNulls bool    // Skip nulls when computing weights
+}
+
+// EwmMean returns the exponentially weighted moving average
+// Example: Col("latency").EwmMean(EwmOptions{Span: 10, Adjust: true})
+func (expr *ExprNode) EwmMean(opts EwmOptions) *ExprNode {
+	return expr.ewm(OpExprEwmMean, "EwmMean", opts)
+}
+
+// EwmStd returns the exponentially weighted moving standard deviation
+func (expr *ExprNode) EwmStd(opts EwmOptions) *ExprNode {
+	return expr.ewm(OpExprEwmStd, "EwmStd", opts)
+}
+
+// ewm is the shared builder of the exponentially weighted statistics
+func (expr *ExprNode) ewm(opcode uint32, opName string, opts EwmOptions) *ExprNode {
+	alpha := opts.Alpha
+	switch {
+	case alpha != 0 && opts.Span != 0:
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() accepts Alpha or Span, not both", opName)))}
+	case opts.Span != 0:
+		if opts.Span < 1 {
+			return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() Span must be at least 1", opName)))}
+		}
+		alpha = 2 / (opts.Span + 1)
+	case !(alpha > 0 && alpha <= 1):
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() Alpha must be in (0, 1]", opName)))}
+	}
+	if opts.MinPeriods < 0 {
+		return &ExprNode{ops: combine(expr.ops, single(errOpf("%s() MinPeriods cannot be negative", opName)))}
+	}
+
+	return &ExprNode{
+		ops: combine(expr.ops, single(Operation{
+			opcode: opcode,
+			key:    exprKey(opcode, fmt.Sprint(alpha, opts.Adjust, opts.Bias, opts.MinPeriods, opts.IgnoreNulls)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.EwmArgs{
+					alpha:        C.double(alpha),
+					adjust:       C.bool(opts.Adjust),
+					bias:         C.bool(opts.Bias),
+					min_periods:  C.size_t(opts.MinPeriods),
+					ignore_nulls: C.bool(opts.IgnoreNulls),
+				})
+			},
+		})),
+	}
+}
+
 // Conditional Expressions (When/Then/Otherwise)
 
 // When starts a conditional expression with a condition
@@ -642,6 +820,33 @@ func (expr *ExprNode) CastStrict(dtype DataType, strict bool) *ExprNode {
 	return expr.CastWithOptions(dtype, strict, false)
 }
 
+// CastEnum casts the expression to an Enum over a fixed, ordered set of categories
+// Values are stored as their index in categories, so comparisons, sorts (in category
+// order), group-bys and joins on the column work on integers. Unlike Categorical,
+// Enums with the same categories are compatible without the global string cache.
+// Usage: Col("size").CastEnum("small", "medium", "large")
+func (expr *ExprNode) CastEnum(categories ...string) *ExprNode {
+	if len(categories) == 0 {
+		return &ExprNode{ops: combine(expr.ops, single(errOp("CastEnum() requires at least one category")))}
+	}
+
+	return &ExprNode{
+		ops: combine(expr.ops, single(Operation{
+			opcode: OpExprCast,
+			key:    exprKey(OpExprCast, fmt.Sprintf("%d %q", uint32(Enum), categories)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.CastArgs{
+					dtype:          C.uint(Enum),
+					strict:         C.bool(true),
+					categories:     a.rawStrs(categories),
+					category_count: C.size_t(len(categories)),
+				})
+			},
+		})),
+	}
+}
+
 // CastWithOptions casts the expression with full control over casting behavior
 // dtype: target data type
 // strict: if true, raise error on invalid cast; if false, produce null values
@@ -650,8 +855,10 @@ func (expr *ExprNode) CastWithOptions(dtype DataType, strict, wrap_numerical boo
 	return &ExprNode{
 		ops: combine(expr.ops, single(Operation{
 			opcode: OpExprCast,
-			args: func() unsafe.Pointer {
-				return unsafe.Pointer(&C.CastArgs{
+			key:    exprKey(OpExprCast, fmt.Sprint(uint32(dtype), strict, wrap_numerical)),
+			arity:  1,
+			args: func(a *argArena) unsafe.Pointer {
+				return arenaNew(a, C.CastArgs{
 					dtype:          C.uint(dtype),
 					strict:         C.bool(strict),
 					wrap_numerical: C.bool(wrap_numerical),
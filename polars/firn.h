@@ -18,10 +18,29 @@ typedef struct {
 } SelectArgs;
 
 
+// Named column type (dtype uses the bit-packed DataType encoding)
+typedef struct {
+    RawStr name;
+    uint32_t dtype;
+} SchemaField;
+
 typedef struct {
     RawStr path;
     bool has_header;  // Whether CSV has header row
     bool with_glob;   // Whether to enable glob pattern expansion
+    SchemaField* schema;           // Full schema - disables inference (NULL for none)
+    size_t schema_count;
+    SchemaField* dtype_overrides;  // Override inferred dtypes for a subset of columns
+    size_t dtype_override_count;
+    int64_t infer_schema_length;   // Rows used for inference (0 = default, -1 = all rows)
+    uint8_t separator;             // Field separator (0 = ',')
+    uint8_t quote_char;            // Quote character (0 = '"')
+    bool disable_quoting;          // Treat quote characters as regular data
+    size_t n_rows;                 // Stop after this many rows (0 = all)
+    size_t skip_rows;              // Lines to skip before the header/data
+    bool low_memory;               // Reduce memory pressure at the expense of speed
+    bool rechunk;                  // Rechunk into contiguous memory after reading
+    size_t chunk_size;             // Rows per parallel parsing chunk (0 = default)
 } ReadCsvArgs;
 
 typedef struct {
@@ -31,11 +50,29 @@ typedef struct {
     size_t n_rows;         // Optional row limit (0 = all rows)
     bool parallel;         // Enable parallel reading
     bool with_glob;        // Whether to expand glob patterns
+    bool use_statistics;   // Prune row groups using min/max statistics
+    uint32_t hive_partitioning; // 0 = auto, 1 = disabled, 2 = enabled
+    bool try_parse_hive_dates;  // Parse date/datetime hive partition values
+    bool low_memory;       // Reduce memory pressure at the expense of speed
+    bool cache;            // Cache the scan result when it is used more than once
+    bool rechunk;          // Rechunk into contiguous memory after reading
+    RawStr row_index_name; // Add a row index column with this name (empty = none)
+    uint32_t row_index_offset; // Starting value of the row index
 } ReadParquetArgs;
 
+// How Concat lines up the columns of its inputs
+typedef enum {
+    ConcatModeVertical = 0,        // Same columns in the same order and types
+    ConcatModeVerticalRelaxed = 1, // Same columns, types cast to their common supertype
+    ConcatModeDiagonal = 2,        // Union of the columns, missing ones filled with nulls
+    ConcatModeDiagonalRelaxed = 3  // Diagonal, types cast to their common supertype
+} ConcatMode;
+
 typedef struct {
-    uintptr_t* handles; // Array of DataFrame handles
+    uintptr_t* handles; // Array of DataFrame or LazyFrame handles
     size_t count;       // Number of handles
+    ConcatMode how;
+    bool parallel;      // Run the input plans in parallel when collected
 } ConcatArgs;
 
 typedef struct {
@@ -91,6 +128,90 @@ typedef struct {
     size_t n;            // Number of rows to limit to
 } LimitArgs;
 
+// Compression codecs for sink operations (IPC supports Uncompressed, Lz4 and Zstd)
+typedef enum {
+    SinkCompressionUncompressed = 0,
+    SinkCompressionSnappy = 1,
+    SinkCompressionGzip = 2,
+    SinkCompressionLz4 = 3,
+    SinkCompressionZstd = 4,
+    SinkCompressionBrotli = 5
+} SinkCompression;
+
+// Sink arguments - stream the current LazyFrame straight to a file
+typedef struct {
+    RawStr path;
+    SinkCompression compression;
+    int32_t compression_level;   // 0 = codec default
+    size_t row_group_size;       // Rows per row group (0 = Polars default)
+    size_t data_page_size;       // Bytes per data page (0 = Polars default)
+    bool statistics;             // Write column statistics for row-group pruning
+    bool maintain_order;
+} SinkParquetArgs;
+
+typedef struct {
+    RawStr path;
+    bool include_header;
+    uint8_t separator;           // 0 = ','
+    size_t batch_size;           // Rows serialized per batch (0 = Polars default)
+    bool maintain_order;
+} SinkCsvArgs;
+
+typedef struct {
+    RawStr path;
+    SinkCompression compression;
+    bool maintain_order;
+} SinkIpcArgs;
+
+// Collect arguments (optional - a NULL args pointer collects in memory)
+typedef struct {
+    bool streaming;        // Execute on the streaming engine (bounded memory)
+    bool disable_predicate_pushdown;  // Optimizer toggles - all passes are on by default
+    bool disable_projection_pushdown;
+    bool disable_slice_pushdown;
+    bool disable_cse;      // Common subplan and subexpression elimination
+} CollectArgs;
+
+// Group by arguments (optional - a NULL args pointer groups without ordering)
+typedef struct {
+    bool maintain_order;   // Keep groups in order of first appearance
+} GroupByArgs;
+
+// Window boundaries for GroupByDynamic and Rolling
+// Default is left-closed for dynamic windows and right-closed for rolling ones
+typedef enum {
+    WindowClosedDefault = 0,
+    WindowClosedLeft = 1,
+    WindowClosedRight = 2,
+    WindowClosedBoth = 3,
+    WindowClosedNone = 4
+} WindowClosed;
+
+typedef enum {
+    WindowLabelLeft = 0,
+    WindowLabelRight = 1,
+    WindowLabelDataPoint = 2
+} WindowLabel;
+
+// Durations use the Polars duration language ("1m", "5m", "1h", "1d12h");
+// extra group keys come from the expression stack
+typedef struct {
+    RawStr index_column;   // Sorted time or integer column
+    RawStr every;          // Interval between window starts
+    RawStr period;         // Window length (empty = every)
+    RawStr offset;         // Shift of the window starts (empty = none)
+    WindowClosed closed;
+    WindowLabel label;
+    bool include_boundaries;
+} GroupByDynamicArgs;
+
+typedef struct {
+    RawStr index_column;   // Sorted time or integer column
+    RawStr period;         // Window length
+    RawStr offset;         // Window shift (empty = -period, windows end at each row)
+    WindowClosed closed;
+} RollingArgs;
+
 typedef struct {
     RawStr sql;
 } QueryArgs;
@@ -105,9 +226,33 @@ typedef enum {
     JoinTypeLeft = 1,
     JoinTypeRight = 2,
     JoinTypeOuter = 3,
-    JoinTypeCross = 4
+    JoinTypeCross = 4,
+    JoinTypeSemi = 5,   // Left rows with a match; no right columns
+    JoinTypeAnti = 6,   // Left rows without a match; no right columns
+    JoinTypeAsof = 7    // Nearest-key match on one sorted column (see AsofArgs)
 } JoinType;
 
+// Key uniqueness checked by a join before it runs
+typedef enum {
+    JoinValidateManyToMany = 0,  // No check
+    JoinValidateManyToOne = 1,   // Right keys are unique
+    JoinValidateOneToMany = 2,   // Left keys are unique
+    JoinValidateOneToOne = 3
+} JoinValidation;
+
+typedef enum {
+    AsofBackward = 0,  // Last right key <= left key
+    AsofForward = 1,   // First right key >= left key
+    AsofNearest = 2
+} AsofStrategy;
+
+typedef struct {
+    AsofStrategy strategy;
+    RawStr tolerance;  // Number, or duration like "5m" for temporal keys (empty = unbounded)
+    RawStr* by;        // Columns that must match exactly before the asof match
+    size_t by_count;
+} AsofArgs;
+
 // Arguments for join operations
 typedef struct {
     uintptr_t other_handle;     // Handle to the right DataFrame
@@ -117,6 +262,9 @@ typedef struct {
     JoinType how;               // Join type (inner, left, etc.)
     RawStr suffix;              // Optional suffix for duplicate columns
     bool coalesce;              // Whether to coalesce join columns (default false)
+    JoinValidation validation;  // Key uniqueness to check (default none)
+    bool sorted_keys;           // Keys are sorted ascending on both sides
+    const AsofArgs* asof;       // Required for JoinTypeAsof, ignored otherwise
 } JoinArgs;
 
 // Window function arguments
@@ -131,16 +279,39 @@ typedef struct {
     int offset;  // For Lag/Lead functions (positive for Lead, negative for Lag)
 } WindowOffsetArgs;
 
+// Rolling window aggregations - the last window_size rows, or the duration
+// ending at each row when a sorted temporal by column is given
+typedef struct {
+    size_t window_size;    // Rows per window (fixed windows)
+    size_t min_periods;    // Non-null values required for a result (0 = window_size, 1 with by)
+    bool center;           // Label fixed windows at their center instead of their last row
+    uint8_t ddof;          // Delta degrees of freedom (RollingStd only)
+    RawStr by;             // Sorted temporal column for duration windows (empty = fixed)
+    RawStr duration;       // Window length with by, e.g. "1h" or "7d"
+    WindowClosed closed;   // Duration window edges (default right)
+} RollingExprArgs;
+
+// Exponentially weighted moving statistics
+typedef struct {
+    double alpha;          // Smoothing factor, 0 < alpha <= 1
+    bool adjust;           // Divide by the decaying weight sum (true) or use the recursive form
+    bool bias;             // EwmStd without the bias correction
+    size_t min_periods;    // Values required before a result is produced
+    bool ignore_nulls;     // Skip nulls when computing weights
+} EwmArgs;
+
 // Cast operation arguments
 typedef struct {
     uint32_t dtype;          // Target data type (bit-packed encoding)
     bool strict;             // If true, raise error on invalid cast; if false, produce null
     bool wrap_numerical;     // If true, wrap overflowing numeric values instead of marking invalid
+    RawStr* categories;      // Enum categories in physical order (Enum dtype only)
+    size_t category_count;
 } CastArgs;
 
 // Centralized literal abstraction - handles all value types
 typedef struct {
-    int value_type;       // 0=int, 1=float, 2=string, 3=bool
+    int value_type;       // 0=int, 1=float, 2=string, 3=bool, 4=null
     long long int_value;
     double float_value;
     RawStr string_value;
@@ -156,6 +327,14 @@ typedef struct {
     Literal literal;
 } LiteralArgs;
 
+typedef struct {
+    uint32_t index; // Parameter slot bound at execute_prepared time
+} ParamArgs;
+
+typedef struct {
+    uint32_t slot; // Subexpression slot written by ExprDup and read by ExprLoad
+} SlotArgs;
+
 // Generic operation structure with opcode and args
 typedef struct {
     uint32_t opcode;       // OpCode for the operation
@@ -181,16 +360,243 @@ typedef struct {
     size_t error_frame;
 } FfiResult;
 
+// Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html)
+// Guarded so the definitions can coexist with other Arrow headers.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+// Arrow C Stream Interface (https://arrow.apache.org/docs/format/CStreamInterface.html)
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+    void (*release)(struct ArrowArrayStream*);
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
+// Arguments for importing Arrow data - set either array+schema or stream
+// Imported arrays and streams are moved (their release is set to NULL); the schema is only borrowed
+typedef struct {
+    struct ArrowArray* array;         // Struct array with one child per column
+    struct ArrowSchema* schema;       // Schema describing the struct array
+    struct ArrowArrayStream* stream;  // Stream of struct arrays (used when array is NULL)
+} ImportArrowArgs;
+
 // Core FFI functions - these are the only functions called from Go
 FfiResult execute_operations(PolarsHandle handle, const Operation* operations, size_t count);
+// Same chain in the packed wire format (see wire.go); strings are borrowed for the call
+FfiResult execute_encoded(PolarsHandle handle, const uint8_t* program, size_t len);
 int release_dataframe(uintptr_t handle);
 void free_string(char* error_message);
 
+// Error codes - CANCELLED and DEADLINE_EXCEEDED are returned when
+// execute_operations_with_options is interrupted
+#define ERROR_NULL_HANDLE 1
+#define ERROR_NULL_ARGS 2
+#define ERROR_INVALID_UTF8 3
+#define ERROR_POLARS_OPERATION 4
+#define ERROR_CANCELLED 5
+#define ERROR_DEADLINE_EXCEEDED 6
+
+// Stop conditions checked between ops and while collecting
+typedef struct {
+    const int32_t* cancelled;  // Set non-zero (atomically) to cancel; caller-owned, NULL for none
+    uint64_t timeout_ms;       // Deadline relative to the start of the call (0 = none)
+    uintptr_t* profile;        // Receives a profile handle when non-NULL (also on error)
+    size_t max_concurrent;     // Wait until fewer calls are running (0 = default from firn_init)
+} ExecutionOptions;
+
+FfiResult execute_operations_with_options(PolarsHandle handle, const Operation* operations, size_t count, const ExecutionOptions* options);
+
+// Process-wide runtime settings - zeroed fields keep the Polars defaults
+typedef struct {
+    size_t num_threads;        // Polars thread pool size (0 = POLARS_MAX_THREADS or one per core)
+    size_t stack_size;         // Worker thread stack size in bytes (0 = Rust default)
+    const size_t* cpus;        // Cores to pin pool workers to, round robin (NULL for none, Linux only)
+    size_t cpu_count;
+    size_t max_concurrent;     // Default limit on concurrently executing calls (0 = unlimited)
+} FirnConfig;
+
+// Must run before the first query; succeeds at most once
+FfiResult firn_init(const FirnConfig* config);
+
+// Execution profiles - row counts and sizes are -1 when the frame is not materialized
+typedef struct {
+    uint32_t opcode;
+    uint64_t wall_ns;          // Time spent dispatching this op
+    int64_t input_rows;
+    int64_t output_rows;
+    int64_t estimated_bytes;   // Estimated heap size of the result frame
+} FrameProfile;
+
+// Polars' own timing of a physical plan node, recorded on collect
+typedef struct {
+    RawStr name;               // Owned by the profile
+    uint64_t start_us;
+    uint64_t end_us;
+} NodeTiming;
+
+// Arrays stay valid until release_profile
+const FrameProfile* profile_frames(uintptr_t profile, size_t* out_count);
+const NodeTiming* profile_nodes(uintptr_t profile, size_t* out_count);
+void release_profile(uintptr_t profile);
+
+// Handle registry - handles are reference counted and typed, so release_dataframe
+// frees DataFrame, LazyFrame and LazyGroupBy handles alike; stale handles are rejected
+int retain_handle(uintptr_t handle);
+size_t live_handle_count(void);
+
+// Memory accounting - the Rust heap is counted by a tracking global allocator when the
+// library is built with the alloc-stats feature; otherwise the allocator fields stay 0
+typedef struct {
+    size_t allocated_bytes;       // Bytes currently allocated on the Rust heap
+    size_t peak_bytes;            // High-water mark of allocated_bytes (see reset_peak_memory)
+    uint64_t allocations;         // Allocations made since the library was loaded
+    size_t dataframe_handles;     // Live handles by context type
+    size_t lazy_frame_handles;
+    size_t lazy_group_by_handles;
+    size_t dataframe_bytes;       // Estimated size of the DataFrames held by handles
+    bool allocator_tracked;       // Built with alloc-stats (allocator fields are valid)
+} MemoryStats;
+
+int memory_stats(MemoryStats* out);
+void reset_peak_memory(void);
+size_t dataframe_estimated_size(uintptr_t handle);
+
+// Batch execution - independent pipelines in one call, collected concurrently
+// out_results must hold count entries; each receives its own handle or error
+typedef struct {
+    PolarsHandle handle;          // Input handle (0 for pipelines starting with a read)
+    const Operation* operations;  // Pipeline ops, without a trailing Collect
+    size_t count;                 // Number of operations
+} PlanDesc;
+
+int execute_batch(const PlanDesc* plans, size_t count, FfiResult* out_results);
+
+// Async queries - submit_query decodes the ops and returns a ticket in polars_handle.handle
+// while the query runs on the Polars thread pool; poll_query returns true once the
+// result has been written to out_result (fetched only once)
+FfiResult submit_query(PolarsHandle handle, const Operation* operations, size_t count);
+bool poll_query(uintptr_t ticket, FfiResult* out_result);
+void cancel_query(uintptr_t ticket);
+int release_query(uintptr_t ticket);
+
+// SQL table registry - named frames visible to every Query, shared with their handles
+// (which may be released afterwards); "df" is reserved for the query input
+int register_table(RawStr name, uintptr_t handle);
+int unregister_table(RawStr name);
+
+// Result cache - frames collected by chains that start from a file read, keyed on the
+// encoded op stream plus each source's path/size/mtime; max_bytes 0 disables it
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t bytes;      // Estimated size of the cached frames
+    size_t max_bytes;  // Byte budget (0 = cache disabled)
+} CacheStats;
+
+void configure_result_cache(size_t max_bytes);
+void clear_result_cache(void);
+int result_cache_stats(CacheStats* out);
+
+// Prepared plans - decode once, execute many times with different parameters
+// prepare_operations returns the plan pointer in polars_handle.handle
+FfiResult prepare_operations(PolarsHandle handle, const Operation* operations, size_t count);
+FfiResult execute_prepared(uintptr_t plan, const Literal* params, size_t count);
+int release_prepared_plan(uintptr_t plan);
+
+// Batch cursors - hand out a collected result in Arrow record batches
+// open_batch_cursor returns the cursor pointer in polars_handle.handle;
+// next_batch writes an array with a NULL release callback once the cursor is exhausted
+FfiResult open_batch_cursor(PolarsHandle handle, const Operation* operations, size_t count);
+int next_batch(uintptr_t cursor, size_t max_rows, struct ArrowArray* out_array, struct ArrowSchema* out_schema);
+int release_batch_cursor(uintptr_t cursor);
+
 // DataFrame introspection
 size_t dataframe_height(uintptr_t handle);
 char* dataframe_to_csv(uintptr_t handle);
 char* dataframe_to_string(uintptr_t handle);
 
+// Schema of a DataFrame, LazyFrame or grouped handle, resolved from the plan for
+// lazy handles (no data is read). Field names point into one packed buffer owned
+// by the schema; on failure error holds the message (freed with free_string).
+typedef struct {
+    const SchemaField* fields;
+    size_t count;
+    uintptr_t owner; // Released with release_schema
+    char* error;
+} SchemaBuffer;
+
+int dataframe_schema(PolarsHandle handle, SchemaBuffer* out);
+void release_schema(uintptr_t owner);
+
+// Global string cache - categoricals created while a token is held share one
+// mapping, so they can be joined and compared across frames by physical value
+uintptr_t string_cache_acquire(void);
+void string_cache_release(uintptr_t token);
+bool string_cache_enabled(void);
+
+// Typed column extraction - dataframe_column_info sizes the buffers, then
+// dataframe_copy_column copies one column (cast strictly to dtype: Int64, Float64,
+// Boolean or String) into them. Booleans take one byte per value; strings fill
+// values with UTF-8 bytes and offsets with len + 1 entries. validity (optional)
+// receives an LSB-first null bitmap of (len + 7) / 8 bytes.
+typedef struct {
+    uint32_t dtype;      // Bit-packed data type (0 = not representable)
+    size_t len;
+    size_t null_count;
+    size_t string_bytes; // UTF-8 payload of String/Categorical columns
+} ColumnInfo;
+
+int dataframe_column_info(uintptr_t handle, RawStr name, ColumnInfo* out);
+int dataframe_copy_column(uintptr_t handle, RawStr name, uint32_t dtype, size_t len,
+                          void* values, size_t values_bytes, int64_t* offsets, uint8_t* validity);
+
+// Logical plan of a handle (optimized or not); *out receives the plan or the
+// error message, freed with free_string. args may be NULL.
+int explain_plan(uintptr_t handle, bool optimized, const CollectArgs* args, char** out);
+
+// Arrow export - fills caller-allocated structs with a struct array sharing the frame's buffers
+int dataframe_to_arrow(uintptr_t handle, struct ArrowArray* out_array, struct ArrowSchema* out_schema);
+
 // Testing and benchmarking helpers
 FfiResult dispatch_add_null_row(uintptr_t handle, uintptr_t args);
 int noop();
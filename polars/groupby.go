@@ -0,0 +1,110 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// WindowClosed selects which window boundaries are included in a window
+// Using C constants to keep in sync with Rust definitions
+type WindowClosed = C.WindowClosed
+
+const (
+	WindowClosedDefault = C.WindowClosedDefault // Left for GroupByDynamic, right for Rolling
+	WindowClosedLeft    = C.WindowClosedLeft
+	WindowClosedRight   = C.WindowClosedRight
+	WindowClosedBoth    = C.WindowClosedBoth
+	WindowClosedNone    = C.WindowClosedNone
+)
+
+// WindowLabel selects which boundary labels a GroupByDynamic window
+type WindowLabel = C.WindowLabel
+
+const (
+	WindowLabelLeft      = C.WindowLabelLeft // Window start (default)
+	WindowLabelRight     = C.WindowLabelRight
+	WindowLabelDataPoint = C.WindowLabelDataPoint // First data point in the window
+)
+
+// DynamicGroupOptions configures GroupByDynamic
+// Durations use the Polars duration language: "30s", "1m", "5m", "1h", "1d12h", or
+// "10i" for integer index columns.
+type DynamicGroupOptions struct {
+	Every             string // Interval between window starts (required)
+	Period            string // Window length (empty = Every)
+	Offset            string // Shift of the window starts (empty = none)
+	Closed            WindowClosed
+	Label             WindowLabel
+	IncludeBoundaries bool // Add _lower_boundary and _upper_boundary columns
+}
+
+// RollingOptions configures Rolling
+type RollingOptions struct {
+	Period string // Window length (required), in the Polars duration language
+	Offset string // Window shift (empty = -Period, so each window ends at its row)
+	Closed WindowClosed
+}
+
+// GroupByStable groups like GroupBy, keeping groups in order of first appearance
+// This is slower than GroupBy; use it when the output order matters.
+func (df *DataFrame) GroupByStable(args ...any) *DataFrame {
+	if len(args) == 0 {
+		return df.appendErrOp("GroupByStable() requires at least one expression")
+	}
+
+	return df.groupBy(args, Operation{
+		opcode: OpGroupBy,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.GroupByArgs{maintain_order: C.bool(true)})
+		},
+	})
+}
+
+// GroupByDynamic groups rows into fixed time windows over a sorted index column
+// Windows are found by walking the sorted index, so there is no need to compute
+// truncated bucket keys first. Optional keys group within each window. Follow with Agg().
+// Example: df.GroupByDynamic("ts", DynamicGroupOptions{Every: "5m"}, "host").Agg(Col("cpu").Mean())
+func (df *DataFrame) GroupByDynamic(indexColumn string, opts DynamicGroupOptions, keys ...any) *DataFrame {
+	if indexColumn == "" || opts.Every == "" {
+		return df.appendErrOp("GroupByDynamic() requires an index column and Every")
+	}
+
+	return df.groupBy(keys, Operation{
+		opcode: OpGroupByDynamic,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.GroupByDynamicArgs{
+				index_column:       a.rawStr(indexColumn),
+				every:              a.rawStr(opts.Every),
+				period:             a.rawStr(opts.Period),
+				offset:             a.rawStr(opts.Offset),
+				closed:             opts.Closed,
+				label:              opts.Label,
+				include_boundaries: C.bool(opts.IncludeBoundaries),
+			})
+		},
+	})
+}
+
+// Rolling groups each row with the rows of a trailing window over a sorted index column
+// Every row starts one window, e.g. "the last 5 minutes at each event". Optional
+// keys restrict each window to rows with the same keys. Follow with Agg().
+func (df *DataFrame) Rolling(indexColumn string, opts RollingOptions, keys ...any) *DataFrame {
+	if indexColumn == "" || opts.Period == "" {
+		return df.appendErrOp("Rolling() requires an index column and Period")
+	}
+
+	return df.groupBy(keys, Operation{
+		opcode: OpRolling,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.RollingArgs{
+				index_column: a.rawStr(indexColumn),
+				period:       a.rawStr(opts.Period),
+				offset:       a.rawStr(opts.Offset),
+				closed:       opts.Closed,
+			})
+		},
+	})
+}
@@ -0,0 +1,114 @@
+package polars
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestGroupByVariants verifies ordered, dynamic and rolling group-bys
+func TestGroupByVariants(t *testing.T) {
+	// Integer index 0..9 on two hosts; windows over it use "i" durations
+	var csv strings.Builder
+	csv.WriteString("t,host,cpu\n")
+	for i := 0; i < 10; i++ {
+		fmt.Fprintf(&csv, "%d,%c,%d\n", i, "ab"[i%2], i*10)
+	}
+	seriesPath := filepath.Join(t.TempDir(), "series.csv")
+	require.NoError(t, os.WriteFile(seriesPath, []byte(csv.String()), 0o644))
+
+	height := func(t *testing.T, df *DataFrame) int {
+		t.Helper()
+		h, err := df.Height()
+		require.NoError(t, err)
+		return h
+	}
+
+	t.Run("MaintainOrder", func(t *testing.T) {
+		result, err := ReadCSV("../testdata/sample.csv").
+			GroupByStable("department").
+			Agg(Col("salary").Sum()).
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (3, 2)
+┌─────────────┬────────┐
+│ department  ┆ salary │
+│ ---         ┆ ---    │
+│ str         ┆ i64    │
+╞═════════════╪════════╡
+│ Engineering ┆ 185000 │
+│ Marketing   ┆ 118000 │
+│ Sales       ┆ 107000 │
+└─────────────┴────────┘`
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("DynamicWindows", func(t *testing.T) {
+		result, err := ReadCSV(seriesPath).
+			GroupByDynamic("t", DynamicGroupOptions{Every: "5i"}).
+			Agg(Col("cpu").Sum()).
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 2)
+┌─────┬─────┐
+│ t   ┆ cpu │
+│ --- ┆ --- │
+│ i64 ┆ i64 │
+╞═════╪═════╡
+│ 0   ┆ 100 │
+│ 5   ┆ 350 │
+└─────┴─────┘`
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("DynamicWindowsWithKeys", func(t *testing.T) {
+		result, err := ReadCSV(seriesPath).
+			GroupByDynamic("t", DynamicGroupOptions{
+				Every:             "5i",
+				Closed:            WindowClosedBoth,
+				IncludeBoundaries: true,
+			}, "host").
+			Agg(Col("cpu").Max()).
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		require.Equal(t, 4, height(t, result)) // Two windows per host
+		csvOut, err := result.ToCsv()
+		require.NoError(t, err)
+		require.Contains(t, csvOut, "_lower_boundary")
+	})
+
+	t.Run("Rolling", func(t *testing.T) {
+		result, err := ReadCSV(seriesPath).
+			Rolling("t", RollingOptions{Period: "3i"}).
+			Agg(Col("cpu").Sum().Alias("cpu_3")).
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		require.Equal(t, 10, height(t, result)) // One window per row
+		csvOut, err := result.ToCsv()
+		require.NoError(t, err)
+		require.True(t, strings.HasSuffix(strings.TrimSpace(csvOut), "9,240")) // Rows 7..9
+	})
+
+	t.Run("InvalidWindow", func(t *testing.T) {
+		_, err := ReadCSV(seriesPath).
+			GroupByDynamic("t", DynamicGroupOptions{Every: "five minutes"}).
+			Agg(Col("cpu").Sum()).
+			Collect()
+		require.Error(t, err)
+
+		_, err = ReadCSV(seriesPath).Rolling("t", RollingOptions{}).Agg(Col("cpu").Sum()).Collect()
+		require.Error(t, err)
+	})
+}
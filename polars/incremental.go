@@ -0,0 +1,224 @@
+package polars
+
+import (
+	"errors"
+	"fmt"
+	"slices"
+	"strconv"
+	"sync"
+)
+
+// AggFunc is a decomposable aggregate that IncrementalGroupBy can maintain
+type AggFunc int
+
+const (
+	AggSum   AggFunc = iota // Sum of non-null values
+	AggCount                // Number of non-null values
+	AggMin
+	AggMax
+	AggMean // Kept as a sum and a count; null for groups with no non-null values
+)
+
+// PartialAgg is one output column of an IncrementalGroupBy
+type PartialAgg struct {
+	Column string  // Input column
+	Func   AggFunc // Aggregate to maintain
+	Alias  string  // Output column name (empty = Column)
+}
+
+// IncrementalGroupBy keeps a materialized group-by that new batches are folded into
+// The state is one row of partial aggregates per group, never the input rows, so
+// each Append costs O(batch rows + groups) instead of re-aggregating the history:
+// the batch is grouped on its own, concatenated with the state, and the partials
+// are merged (sums and counts add up, mins and maxes combine). Append and Result
+// are safe to call from different goroutines. Release frees the state.
+type IncrementalGroupBy struct {
+	mu    sync.Mutex
+	keys  []string
+	aggs  []PartialAgg
+	state *DataFrame // Collected partial aggregates (nil before the first Append)
+}
+
+// NewIncrementalGroupBy creates an empty aggregate grouped by the key columns
+// Example: NewIncrementalGroupBy([]string{"host"}, PartialAgg{Column: "cpu", Func: AggMean})
+func NewIncrementalGroupBy(keys []string, aggs ...PartialAgg) (*IncrementalGroupBy, error) {
+	if len(keys) == 0 || len(aggs) == 0 {
+		return nil, errors.New("NewIncrementalGroupBy: requires at least one key and one aggregate")
+	}
+
+	names := make(map[string]bool, len(keys)+len(aggs))
+	g := &IncrementalGroupBy{aggs: make([]PartialAgg, len(aggs))}
+	for _, key := range keys {
+		names[key] = true
+	}
+	g.keys = append(g.keys, keys...)
+	for i, agg := range aggs {
+		if agg.Column == "" || agg.Func < AggSum || agg.Func > AggMean {
+			return nil, fmt.Errorf("NewIncrementalGroupBy: invalid aggregate %+v", agg)
+		}
+		if agg.Alias == "" {
+			agg.Alias = agg.Column
+		}
+		if names[agg.Alias] {
+			return nil, fmt.Errorf("NewIncrementalGroupBy: duplicate output column %q", agg.Alias)
+		}
+		names[agg.Alias] = true
+		g.aggs[i] = agg
+	}
+	return g, nil
+}
+
+// stateColumn names the partial column holding part of aggregate i
+func stateColumn(i int, part string) string {
+	return "__firn_" + strconv.Itoa(i) + "_" + part
+}
+
+// keyExprs returns fresh column expressions for the keys
+// Plain strings would be parsed as SQL, which breaks on keywords and special characters.
+func (g *IncrementalGroupBy) keyExprs() []any {
+	exprs := make([]any, len(g.keys))
+	for i, key := range g.keys {
+		exprs[i] = Col(key)
+	}
+	return exprs
+}
+
+// partials aggregates a batch into state columns
+func (g *IncrementalGroupBy) partials() []any {
+	var exprs []any
+	for i, agg := range g.aggs {
+		switch agg.Func {
+		case AggSum:
+			exprs = append(exprs, Col(agg.Column).Sum().Alias(stateColumn(i, "sum")))
+		case AggCount:
+			exprs = append(exprs, Col(agg.Column).Count().Alias(stateColumn(i, "count")))
+		case AggMin:
+			exprs = append(exprs, Col(agg.Column).Min().Alias(stateColumn(i, "min")))
+		case AggMax:
+			exprs = append(exprs, Col(agg.Column).Max().Alias(stateColumn(i, "max")))
+		case AggMean:
+			exprs = append(exprs,
+				Col(agg.Column).Sum().Alias(stateColumn(i, "sum")),
+				Col(agg.Column).Count().Alias(stateColumn(i, "count")))
+		}
+	}
+	return exprs
+}
+
+// merges combines state rows of the same group
+func (g *IncrementalGroupBy) merges() []any {
+	var exprs []any
+	for i, agg := range g.aggs {
+		switch agg.Func {
+		case AggSum:
+			exprs = append(exprs, Col(stateColumn(i, "sum")).Sum())
+		case AggCount:
+			exprs = append(exprs, Col(stateColumn(i, "count")).Sum())
+		case AggMin:
+			exprs = append(exprs, Col(stateColumn(i, "min")).Min())
+		case AggMax:
+			exprs = append(exprs, Col(stateColumn(i, "max")).Max())
+		case AggMean:
+			exprs = append(exprs, Col(stateColumn(i, "sum")).Sum(), Col(stateColumn(i, "count")).Sum())
+		}
+	}
+	return exprs
+}
+
+// finals turns state columns into the output columns
+func (g *IncrementalGroupBy) finals() []any {
+	exprs := g.keyExprs()
+	for i, agg := range g.aggs {
+		switch agg.Func {
+		case AggSum:
+			exprs = append(exprs, Col(stateColumn(i, "sum")).Alias(agg.Alias))
+		case AggCount:
+			exprs = append(exprs, Col(stateColumn(i, "count")).Alias(agg.Alias))
+		case AggMin:
+			exprs = append(exprs, Col(stateColumn(i, "min")).Alias(agg.Alias))
+		case AggMax:
+			exprs = append(exprs, Col(stateColumn(i, "max")).Alias(agg.Alias))
+		case AggMean:
+			mean := Col(stateColumn(i, "sum")).Cast(Float64).Div(Col(stateColumn(i, "count")).Cast(Float64))
+			exprs = append(exprs, When(Col(stateColumn(i, "count")).Gt(Lit(0))).
+				Then(mean).
+				Otherwise(Lit(nil)).
+				Alias(agg.Alias))
+		}
+	}
+	return exprs
+}
+
+// Append folds a batch of new rows into the aggregate
+// The batch may be a pending pipeline (e.g. ReadParquet of the latest file) or an
+// executed DataFrame. Either way it is left untouched and still owned by the
+// caller: the partial aggregate is built on a copy of its pending operations. On
+// error the state is unchanged.
+func (g *IncrementalGroupBy) Append(batch *DataFrame) error {
+	if batch == nil {
+		return errors.New("Append: batch cannot be nil")
+	}
+
+	input := &DataFrame{handle: batch.handle, operations: slices.Clone(batch.operations)}
+	partial := input.GroupBy(g.keyExprs()...).Agg(g.partials()...)
+
+	g.mu.Lock()
+	defer g.mu.Unlock()
+
+	// Types may widen between batches (e.g. an all-integer batch after floats)
+	opts := ConcatOptions{Mode: ConcatVerticalRelaxed}
+	if g.state == nil {
+		state, err := ConcatWithOptions(opts, partial).Collect()
+		if err != nil {
+			return err
+		}
+		g.state = state
+		return nil
+	}
+
+	merged, err := ConcatWithOptions(opts, g.state, partial).
+		GroupBy(g.keyExprs()...).
+		Agg(g.merges()...).
+		Collect()
+	if err != nil {
+		return err
+	}
+	g.state.Release()
+	g.state = merged
+	return nil
+}
+
+// Result returns the current aggregates as a new executed DataFrame
+// It reads only the state, one row per group; the caller must Release() it.
+func (g *IncrementalGroupBy) Result() (*DataFrame, error) {
+	g.mu.Lock()
+	defer g.mu.Unlock()
+
+	if g.state == nil {
+		return nil, errors.New("Result: no batches appended")
+	}
+	view, err := g.state.Share()
+	if err != nil {
+		return nil, err
+	}
+	result, err := view.Select(g.finals()...).Collect()
+	if err != nil {
+		view.Release()
+		return nil, err
+	}
+	return result, nil
+}
+
+// Release frees the aggregate state
+// The aggregate starts over empty if more batches are appended afterwards.
+func (g *IncrementalGroupBy) Release() error {
+	g.mu.Lock()
+	defer g.mu.Unlock()
+
+	if g.state == nil {
+		return nil
+	}
+	err := g.state.Release()
+	g.state = nil
+	return err
+}
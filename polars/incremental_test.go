@@ -0,0 +1,159 @@
+package polars
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestIncrementalGroupBy verifies folding batches into a materialized aggregate
+func TestIncrementalGroupBy(t *testing.T) {
+	aggs := []PartialAgg{
+		{Column: "salary", Func: AggSum, Alias: "total"},
+		{Column: "salary", Func: AggCount, Alias: "n"},
+		{Column: "salary", Func: AggMin, Alias: "lowest"},
+		{Column: "salary", Func: AggMax, Alias: "highest"},
+		{Column: "age", Func: AggMean},
+	}
+	sorted := func(t *testing.T, df *DataFrame) string {
+		t.Helper()
+		result, err := df.Sort([]string{"department"}).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+		return result.String()
+	}
+
+	t.Run("MatchesFullAggregation", func(t *testing.T) {
+		g, err := NewIncrementalGroupBy([]string{"department"}, aggs...)
+		require.NoError(t, err)
+		defer g.Release()
+
+		// Pending and executed batches
+		young := ReadCSV("../testdata/sample.csv").Filter(Col("age").Lt(Lit(30)))
+		defer young.Release()
+		pending := len(young.operations)
+		require.NoError(t, g.Append(young))
+		require.Len(t, young.operations, pending) // Pending batches are left untouched too
+		require.Zero(t, young.handle.handle)
+		old, err := ReadCSV("../testdata/sample.csv").Filter(Col("age").Gt(Lit(29))).Collect()
+		require.NoError(t, err)
+		defer old.Release()
+		require.NoError(t, g.Append(old))
+
+		height, err := old.Height()
+		require.NoError(t, err)
+		require.Equal(t, 3, height) // Executed batches are left untouched
+
+		result, err := g.Result()
+		require.NoError(t, err)
+		defer result.Release()
+
+		full := ReadCSV("../testdata/sample.csv").GroupBy("department").Agg(
+			Col("salary").Sum().Alias("total"),
+			Col("salary").Count().Alias("n"),
+			Col("salary").Min().Alias("lowest"),
+			Col("salary").Max().Alias("highest"),
+			Col("age").Mean(),
+		)
+		require.Equal(t, sorted(t, full), sorted(t, result))
+	})
+
+	t.Run("StateOutlivesInputs", func(t *testing.T) {
+		g, err := NewIncrementalGroupBy([]string{"department"}, PartialAgg{Column: "salary", Func: AggSum})
+		require.NoError(t, err)
+		defer g.Release()
+
+		// Each batch file is deleted once appended, so Result cannot rescan history
+		data, err := os.ReadFile("../testdata/sample.csv")
+		require.NoError(t, err)
+		for i := 0; i < 3; i++ {
+			path := filepath.Join(t.TempDir(), "batch.csv")
+			require.NoError(t, os.WriteFile(path, data, 0o644))
+			batch := ReadCSV(path)
+			require.NoError(t, g.Append(batch))
+			batch.Release()
+			require.NoError(t, os.Remove(path))
+		}
+
+		result, err := g.Result()
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 3, height) // One row per department
+
+		ordered, err := result.Sort([]string{"department"}).Collect()
+		require.NoError(t, err)
+		defer ordered.Release()
+		totals := make([]float64, 3)
+		require.NoError(t, ordered.Float64Column("salary", totals, nil))
+		require.Equal(t, []float64{3 * 185000, 3 * 118000, 3 * 107000}, totals)
+	})
+
+	t.Run("NullValues", func(t *testing.T) {
+		// "group" is an SQL keyword, so keys must not go through the SQL parser
+		path := filepath.Join(t.TempDir(), "nulls.csv")
+		require.NoError(t, os.WriteFile(path, []byte("group,v\na,1\na,\nb,\nc,2.5\n"), 0o644))
+
+		g, err := NewIncrementalGroupBy([]string{"group"},
+			PartialAgg{Column: "v", Func: AggSum, Alias: "total"},
+			PartialAgg{Column: "v", Func: AggCount, Alias: "n"},
+			PartialAgg{Column: "v", Func: AggMin, Alias: "lowest"},
+			PartialAgg{Column: "v", Func: AggMean, Alias: "avg"})
+		require.NoError(t, err)
+		defer g.Release()
+
+		for i := 0; i < 2; i++ {
+			batch := ReadCSV(path)
+			require.NoError(t, g.Append(batch))
+			batch.Release()
+		}
+
+		result, err := g.Result()
+		require.NoError(t, err)
+		defer result.Release()
+
+		ordered, err := result.Sort([]string{"group"}).Collect()
+		require.NoError(t, err)
+		defer ordered.Release()
+
+		// Group b has only nulls: its mean is null rather than NaN
+		csv, err := ordered.ToCsv()
+		require.NoError(t, err)
+		require.Equal(t, "group,total,n,lowest,avg\na,2.0,2,1.0,1.0\nb,0.0,0,,\nc,5.0,2,2.5,2.5\n", csv)
+	})
+
+	t.Run("FailedAppendKeepsState", func(t *testing.T) {
+		g, err := NewIncrementalGroupBy([]string{"department"}, PartialAgg{Column: "salary", Func: AggMax})
+		require.NoError(t, err)
+		defer g.Release()
+
+		_, err = g.Result()
+		require.Error(t, err)
+
+		require.NoError(t, g.Append(ReadCSV("../testdata/sample.csv")))
+		require.Error(t, g.Append(ReadCSV("../testdata/sample.csv").Select("name")))
+
+		result, err := g.Result()
+		require.NoError(t, err)
+		defer result.Release()
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 3, height)
+	})
+
+	t.Run("InvalidAggregates", func(t *testing.T) {
+		_, err := NewIncrementalGroupBy(nil, aggs...)
+		require.Error(t, err)
+		_, err = NewIncrementalGroupBy([]string{"department"}, PartialAgg{Func: AggSum})
+		require.Error(t, err)
+		_, err = NewIncrementalGroupBy([]string{"department"}, PartialAgg{Column: "salary", Func: AggFunc(9)})
+		require.Error(t, err)
+		_, err = NewIncrementalGroupBy([]string{"department"},
+			PartialAgg{Column: "salary", Func: AggMin}, PartialAgg{Column: "salary", Func: AggMax})
+		require.ErrorContains(t, err, "duplicate output column")
+	})
+}
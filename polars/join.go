@@ -18,15 +18,49 @@ const (
 	JoinTypeRight = C.JoinTypeRight
 	JoinTypeOuter = C.JoinTypeOuter // Maps to Polars' Full join
 	JoinTypeCross = C.JoinTypeCross
+	JoinTypeSemi  = C.JoinTypeSemi // Left rows with a match, left columns only
+	JoinTypeAnti  = C.JoinTypeAnti // Left rows without a match, left columns only
 )
 
+// JoinValidation checks key uniqueness before joining, failing the join on violation
+type JoinValidation = C.JoinValidation
+
+const (
+	JoinValidateManyToMany = C.JoinValidateManyToMany // No check (default)
+	JoinValidateManyToOne  = C.JoinValidateManyToOne  // Right keys are unique
+	JoinValidateOneToMany  = C.JoinValidateOneToMany  // Left keys are unique
+	JoinValidateOneToOne   = C.JoinValidateOneToOne
+)
+
+// AsofStrategy selects which right row an asof join matches
+type AsofStrategy = C.AsofStrategy
+
+const (
+	AsofBackward = C.AsofBackward // Last right key <= left key (default)
+	AsofForward  = C.AsofForward  // First right key >= left key
+	AsofNearest  = C.AsofNearest  // Closest right key
+)
+
+// AsofOptions configures JoinAsof
+type AsofOptions struct {
+	Strategy AsofStrategy
+	// Tolerance bounds the key distance of a match: a number for numeric keys or a
+	// duration such as "5m" for temporal keys (empty = unbounded)
+	Tolerance string
+	// By lists columns that must match exactly before the asof match (e.g. a ticker)
+	By []string
+}
+
 // JoinSpec represents the specification for a join operation
 type JoinSpec struct {
-	leftOn    []string
-	rightOn   []string
-	joinType  JoinType
-	suffix    string
-	coalesce  bool
+	leftOn     []string
+	rightOn    []string
+	joinType   JoinType
+	suffix     string
+	coalesce   bool
+	validation JoinValidation
+	sortedKeys bool
+	asof       *AsofOptions // Set by JoinAsof
 }
 
 // On creates a JoinSpec for joining on the same column names in both DataFrames
@@ -82,6 +116,24 @@ func (spec JoinSpec) WithCoalesce(coalesce bool) JoinSpec {
 	return spec
 }
 
+// WithValidation checks key uniqueness before joining
+func (spec JoinSpec) WithValidation(validation JoinValidation) JoinSpec {
+	spec.validation = validation
+	return spec
+}
+
+// WithSortedKeys declares that the join keys are already sorted ascending on both sides
+// It sets Polars' sorted flag on the leading key of each side. That is metadata, not
+// a join strategy: it does not skip the hash build in general, it only lets the code
+// paths that consult the flag trust the order instead of checking it. Later keys are sorted within runs of the leading one
+// at best and stay unflagged, and the flag is cleared on the output keys so the
+// joined order is not trusted downstream. The result is unspecified if the keys are
+// not actually sorted.
+func (spec JoinSpec) WithSortedKeys() JoinSpec {
+	spec.sortedKeys = true
+	return spec
+}
+
 // Join performs a join operation with another DataFrame
 func (df *DataFrame) Join(other *DataFrame, spec JoinSpec) *DataFrame {
 	// Validate inputs
@@ -105,27 +157,18 @@ func (df *DataFrame) Join(other *DataFrame, spec JoinSpec) *DataFrame {
 
 	op := Operation{
 		opcode: OpJoin,
-		args: func() unsafe.Pointer {
-			// Convert left column names to RawStr array
-			leftRawStrs := make([]C.RawStr, len(spec.leftOn))
-			for i, col := range spec.leftOn {
-				leftRawStrs[i] = makeRawStr(col)
-			}
-
-			// Convert right column names to RawStr array  
-			rightRawStrs := make([]C.RawStr, len(spec.rightOn))
-			for i, col := range spec.rightOn {
-				rightRawStrs[i] = makeRawStr(col)
-			}
-
-			return unsafe.Pointer(&C.JoinArgs{
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.JoinArgs{
 				other_handle:  C.uintptr_t(other.handle.handle),
-				left_on:      (*C.RawStr)(unsafe.Pointer(&leftRawStrs[0])),
-				right_on:     (*C.RawStr)(unsafe.Pointer(&rightRawStrs[0])),
+				left_on:      a.rawStrs(spec.leftOn),
+				right_on:     a.rawStrs(spec.rightOn),
 				column_count: C.uintptr_t(len(spec.leftOn)),
 				how:          C.JoinType(spec.joinType),
-				suffix:       makeRawStr(spec.suffix),
+				suffix:       a.rawStr(spec.suffix),
 				coalesce:     C.bool(spec.coalesce),
+				validation:   spec.validation,
+				sorted_keys:  C.bool(spec.sortedKeys),
+				asof:         makeAsofArgs(a, spec.asof),
 			})
 		},
 	}
@@ -156,6 +199,40 @@ func (df *DataFrame) OuterJoin(other *DataFrame, columns ...string) *DataFrame {
 	return df.Join(other, On(columns...).WithType(JoinTypeOuter))
 }
 
+// SemiJoin keeps the rows with a match in other, without adding other's columns
+func (df *DataFrame) SemiJoin(other *DataFrame, columns ...string) *DataFrame {
+	return df.Join(other, On(columns...).WithType(JoinTypeSemi))
+}
+
+// AntiJoin keeps the rows without a match in other
+func (df *DataFrame) AntiJoin(other *DataFrame, columns ...string) *DataFrame {
+	return df.Join(other, On(columns...).WithType(JoinTypeAnti))
+}
+
+// JoinAsof matches each row with the nearest row of other by a sorted key
+// Both sides must be sorted by their key (within each By group). Typical use is
+// aligning time series, e.g. trades with the latest quote at or before each trade.
+func (df *DataFrame) JoinAsof(other *DataFrame, leftOn, rightOn string, opts AsofOptions) *DataFrame {
+	spec := LeftOn(leftOn).RightOn(rightOn)
+	spec.joinType = C.JoinTypeAsof
+	spec.asof = &opts
+	return df.Join(other, spec)
+}
+
+// makeAsofArgs converts asof options to their C representation (nil for other joins)
+func makeAsofArgs(a *argArena, opts *AsofOptions) *C.AsofArgs {
+	if opts == nil {
+		return nil
+	}
+
+	return (*C.AsofArgs)(arenaNew(a, C.AsofArgs{
+		strategy:  opts.Strategy,
+		tolerance: a.rawStr(opts.Tolerance),
+		by:        a.rawStrs(opts.By),
+		by_count:  C.size_t(len(opts.By)),
+	}))
+}
+
 // CrossJoin performs a cross join (Cartesian product)
 func (df *DataFrame) CrossJoin(other *DataFrame) *DataFrame {
 	// Validate inputs
@@ -170,15 +247,15 @@ func (df *DataFrame) CrossJoin(other *DataFrame) *DataFrame {
 
 	op := Operation{
 		opcode: OpJoin,
-		args: func() unsafe.Pointer {
+		args: func(a *argArena) unsafe.Pointer {
 			// Cross join doesn't use join columns, so pass empty arrays
-			return unsafe.Pointer(&C.JoinArgs{
+			return arenaNew(a, C.JoinArgs{
 				other_handle:  C.uintptr_t(other.handle.handle),
 				left_on:      nil, // No join columns for cross join
 				right_on:     nil, // No join columns for cross join
 				column_count: C.uintptr_t(0), // No columns
 				how:          C.JoinType(JoinTypeCross),
-				suffix:       makeRawStr(""),
+				suffix:       a.rawStr(""),
 				coalesce:     C.bool(false),
 			})
 		},
@@ -0,0 +1,55 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+
+// MemoryStats reports the memory held by the Rust side
+// Allocation counters cover the whole Rust heap (frames, plans, caches and
+// transient query state) and are only kept when the Rust library is built with
+// the alloc-stats feature; the handle fields break down the frames Go still holds.
+type MemoryStats struct {
+	AllocatorTracked bool   // Built with alloc-stats; the three allocator fields are 0 otherwise
+	AllocatedBytes   int    // Bytes currently allocated on the Rust heap
+	PeakBytes        int    // High-water mark of AllocatedBytes since start or ResetPeakMemory
+	Allocations      uint64 // Allocations made since the library was loaded
+	DataFrames       int    // Live DataFrame handles
+	LazyFrames       int    // Live LazyFrame handles
+	LazyGroupBys     int    // Live LazyGroupBy handles
+	DataFrameBytes   int    // Estimated size of the DataFrames held by handles (shared frames counted once)
+}
+
+// MemStats returns the current Rust memory counters
+// Cheap enough to export on every metrics scrape: the allocator counters are
+// atomic loads, and the handle breakdown walks the registry once. A DataFrames or
+// LazyFrames count that only grows points at handles that are never released.
+func MemStats() MemoryStats {
+	var stats C.MemoryStats
+	C.memory_stats(&stats)
+	return MemoryStats{
+		AllocatorTracked: bool(stats.allocator_tracked),
+		AllocatedBytes:   int(stats.allocated_bytes),
+		PeakBytes:        int(stats.peak_bytes),
+		Allocations:      uint64(stats.allocations),
+		DataFrames:       int(stats.dataframe_handles),
+		LazyFrames:       int(stats.lazy_frame_handles),
+		LazyGroupBys:     int(stats.lazy_group_by_handles),
+		DataFrameBytes:   int(stats.dataframe_bytes),
+	}
+}
+
+// ResetPeakMemory restarts peak tracking from the current allocation level
+// Call it after each scrape to report per-interval peaks. A no-op without alloc-stats.
+func ResetPeakMemory() {
+	C.reset_peak_memory()
+}
+
+// EstimatedSize returns the estimated heap size of an executed DataFrame in bytes
+// Buffers shared with other frames (e.g. after Clone) are included in full.
+func (df *DataFrame) EstimatedSize() (int, error) {
+	if err := df.requireCollected(); err != nil {
+		return 0, err
+	}
+	return int(C.dataframe_estimated_size(df.handle.handle)), nil
+}
@@ -0,0 +1,77 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestMemoryStats verifies allocator counters, handle breakdown and frame sizes
+func TestMemoryStats(t *testing.T) {
+	t.Run("HandleBreakdown", func(t *testing.T) {
+		baseline := MemStats()
+
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		lazy, err := ReadCSV("../testdata/sample.csv").Select("name").execute()
+		require.NoError(t, err)
+		grouped, err := ReadCSV("../testdata/sample.csv").GroupBy("department").execute()
+		require.NoError(t, err)
+
+		stats := MemStats()
+		require.Equal(t, baseline.DataFrames+1, stats.DataFrames)
+		require.Equal(t, baseline.LazyFrames+1, stats.LazyFrames)
+		require.Equal(t, baseline.LazyGroupBys+1, stats.LazyGroupBys)
+		require.Greater(t, stats.DataFrameBytes, baseline.DataFrameBytes)
+		if stats.AllocatorTracked {
+			require.Greater(t, stats.Allocations, baseline.Allocations)
+			require.GreaterOrEqual(t, stats.PeakBytes, stats.AllocatedBytes)
+			require.Greater(t, stats.AllocatedBytes, 0)
+		} else {
+			require.Zero(t, stats.Allocations)
+			require.Zero(t, stats.AllocatedBytes)
+		}
+
+		require.NoError(t, df.Release())
+		require.NoError(t, lazy.Release())
+		require.NoError(t, grouped.Release())
+		stats = MemStats()
+		require.Equal(t, baseline.DataFrames, stats.DataFrames)
+		require.Equal(t, baseline.LazyFrames, stats.LazyFrames)
+		require.Equal(t, baseline.LazyGroupBys, stats.LazyGroupBys)
+	})
+
+	t.Run("SharedFrameCountedOnce", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+		before := MemStats()
+
+		shared, err := df.Share()
+		require.NoError(t, err)
+		defer shared.Release()
+
+		after := MemStats()
+		require.Equal(t, before.DataFrames, after.DataFrames)
+		require.Equal(t, before.DataFrameBytes, after.DataFrameBytes)
+	})
+
+	t.Run("EstimatedSize", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		size, err := df.EstimatedSize()
+		require.NoError(t, err)
+		require.Greater(t, size, 0)
+
+		_, err = ReadCSV("../testdata/sample.csv").EstimatedSize()
+		require.Error(t, err)
+	})
+
+	t.Run("ResetPeak", func(t *testing.T) {
+		ResetPeakMemory()
+		stats := MemStats()
+		require.GreaterOrEqual(t, stats.PeakBytes, stats.AllocatedBytes)
+	})
+}
@@ -10,23 +10,29 @@ import "C"
 // update these constants to match the Rust enum values exactly!
 const (
 	// DataFrame operations
-	OpNewEmpty    = 1
-	OpReadCsv     = 2
-	OpReadParquet = 3
-	OpSelect      = 4
-	OpSelectExpr  = 5
-	OpCount       = 6
-	OpConcat      = 7
-	OpWithColumn  = 8
-	OpFilterExpr  = 9
-	OpGroupBy     = 10
-	OpAddNullRow  = 11
-	OpCollect     = 12
-	OpAgg         = 13
-	OpSort        = 14
-	OpLimit       = 15
-	OpQuery       = 16
-	OpJoin        = 17
+	OpNewEmpty       = 1
+	OpReadCsv        = 2
+	OpReadParquet    = 3
+	OpSelect         = 4
+	OpSelectExpr     = 5
+	OpCount          = 6
+	OpConcat         = 7
+	OpWithColumn     = 8
+	OpFilterExpr     = 9
+	OpGroupBy        = 10
+	OpAddNullRow     = 11
+	OpCollect        = 12
+	OpAgg            = 13
+	OpSort           = 14
+	OpLimit          = 15
+	OpQuery          = 16
+	OpJoin           = 17
+	OpImportArrow    = 18
+	OpSinkParquet    = 19
+	OpSinkCsv        = 20
+	OpSinkIpc        = 21
+	OpGroupByDynamic = 22
+	OpRolling        = 23
 	
 	// Expression operations (stack-based)
 	OpExprColumn         = 100
@@ -80,9 +86,39 @@ const (
 	// Cast operations
 	OpExprCast = 160 // Cast expression to different data type
 
+	// Prepared plan parameters
+	OpExprParam = 170 // Placeholder bound by ExecutePrepared
+
+	// Common subexpression references (emitted by buildOperations, not by builders)
+	OpExprDup  = 180 // Save the top expression into a slot, leaving it on the stack
+	OpExprLoad = 181 // Push a copy of a saved expression
+
+	// Rolling window aggregations
+	OpExprRollingSum  = 190
+	OpExprRollingMean = 191
+	OpExprRollingMin  = 192
+	OpExprRollingMax  = 193
+	OpExprRollingStd  = 194
+
+	// Cumulative aggregations
+	OpExprCumSum = 200
+	OpExprCumMin = 201
+	OpExprCumMax = 202
+
+	// Exponentially weighted moving statistics
+	OpExprEwmMean = 210
+	OpExprEwmStd  = 211
+
 	// Error operation for fluent API error handling
 	OpError = 999
 )
 
+// Context type constants matching Rust ContextType enum
+const (
+	contextDataFrame   = 1 // Concrete DataFrame
+	contextLazyFrame   = 2 // Lazy DataFrame
+	contextLazyGroupBy = 3 // Grouped lazy frame
+)
+
 // Note: Sort direction and nulls ordering constants are defined directly
 // in sort.go using C.SORT_DIRECTION_* and C.NULLS_ORDERING_* constants
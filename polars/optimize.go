@@ -0,0 +1,290 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"math"
+	"strconv"
+	"unsafe"
+)
+
+// Build-time expression optimizations: constant folding in the builders and
+// common subexpression sharing when the op stream is built.
+
+// exprKey builds the structural key of an expression op from its opcode and args
+func exprKey(opcode uint32, args string) string {
+	return strconv.FormatUint(uint64(opcode), 10) + ":" + args
+}
+
+// literalKey keys a literal by the value Rust decodes (int and int64 are the same literal)
+func literalKey(value any) string {
+	switch v := value.(type) {
+	case int:
+		return exprKey(OpExprLiteral, "i"+strconv.Itoa(v))
+	case int64:
+		return exprKey(OpExprLiteral, "i"+strconv.FormatInt(v, 10))
+	case float64:
+		return exprKey(OpExprLiteral, "f"+strconv.FormatFloat(v, 'g', -1, 64))
+	case string:
+		return exprKey(OpExprLiteral, "s"+strconv.Quote(v))
+	case bool:
+		return exprKey(OpExprLiteral, "b"+strconv.FormatBool(v))
+	case nil:
+		return exprKey(OpExprLiteral, "n")
+	default:
+		return "" // Rejected when the literal is encoded
+	}
+}
+
+// Constant folding
+
+// literalInt returns an integer literal value as Rust sees it (int64)
+func literalInt(value any) (int64, bool) {
+	switch v := value.(type) {
+	case int:
+		return int64(v), true
+	case int64:
+		return v, true
+	default:
+		return 0, false
+	}
+}
+
+// literalFloat returns a numeric literal as float64, the supertype Polars casts mixed operands to
+func literalFloat(value any) (float64, bool) {
+	if v, ok := value.(float64); ok {
+		return v, true
+	}
+	v, ok := literalInt(value)
+	return float64(v), ok
+}
+
+// foldBinary evaluates a binary op on two literal values the way Polars would
+// Only cases where Go and Polars agree exactly are folded: integer arithmetic that
+// does not overflow, float arithmetic, comparisons without NaN and boolean logic.
+// Integer division is left to Polars.
+func foldBinary(opcode uint32, left, right any) (any, bool) {
+	if left == nil || right == nil {
+		return nil, false
+	}
+
+	if l, ok := literalInt(left); ok {
+		if r, ok := literalInt(right); ok {
+			return foldInts(opcode, l, r)
+		}
+	}
+	if l, ok := literalFloat(left); ok {
+		if r, ok := literalFloat(right); ok {
+			return foldFloats(opcode, l, r)
+		}
+	}
+
+	switch l := left.(type) {
+	case bool:
+		r, ok := right.(bool)
+		if !ok {
+			return nil, false
+		}
+		switch opcode {
+		case OpExprAnd:
+			return l && r, true
+		case OpExprOr:
+			return l || r, true
+		case OpExprEq:
+			return l == r, true
+		}
+	case string:
+		if r, ok := right.(string); ok && opcode == OpExprEq {
+			return l == r, true
+		}
+	}
+	return nil, false
+}
+
+func foldInts(opcode uint32, l, r int64) (any, bool) {
+	switch opcode {
+	case OpExprAdd:
+		sum := l + r
+		if (l > 0 && r > 0 && sum < 0) || (l < 0 && r < 0 && sum >= 0) {
+			return nil, false
+		}
+		return sum, true
+	case OpExprSub:
+		diff := l - r
+		if (l >= 0 && r < 0 && diff < 0) || (l < 0 && r > 0 && diff >= 0) {
+			return nil, false
+		}
+		return diff, true
+	case OpExprMul:
+		if l == 0 || r == 0 {
+			return int64(0), true
+		}
+		product := l * r
+		if product/r != l || (l == -1 && r == math.MinInt64) || (r == -1 && l == math.MinInt64) {
+			return nil, false
+		}
+		return product, true
+	case OpExprGt:
+		return l > r, true
+	case OpExprLt:
+		return l < r, true
+	case OpExprEq:
+		return l == r, true
+	}
+	return nil, false
+}
+
+func foldFloats(opcode uint32, l, r float64) (any, bool) {
+	switch opcode {
+	case OpExprAdd:
+		return l + r, true
+	case OpExprSub:
+		return l - r, true
+	case OpExprMul:
+		return l * r, true
+	case OpExprDiv:
+		return l / r, true
+	}
+
+	if math.IsNaN(l) || math.IsNaN(r) {
+		return nil, false // Polars orders NaN as a value, Go does not
+	}
+	switch opcode {
+	case OpExprGt:
+		return l > r, true
+	case OpExprLt:
+		return l < r, true
+	case OpExprEq:
+		return l == r, true
+	}
+	return nil, false
+}
+
+// Common subexpression sharing
+//
+// The op stream is postfix, so the subtree each expression op completes can be
+// rebuilt with a stack of (subtree id, first op) entries. Structurally identical
+// subtrees intern to the same id. When a subtree repeats often enough to pay off,
+// its first occurrence is followed by an ExprDup into a slot and every later
+// occurrence is replaced by a single ExprLoad, so Rust decodes it only once.
+
+type exprEntry struct {
+	id    int // Interned subtree id, -1 when the subtree cannot be shared
+	start int // Position of the subtree's first op
+}
+
+type exprDedup struct {
+	ids    map[string]int // Op key plus child ids -> subtree id
+	counts []int          // Occurrences per subtree id
+	sizes  []int          // Ops per subtree id
+	stack  []exprEntry
+}
+
+// push records the subtree completed by op; pos is the position of op itself
+func (d *exprDedup) push(op Operation, pos int) exprEntry {
+	arity := int(op.arity)
+	if op.opcode < 100 || op.key == "" || len(d.stack) < arity {
+		// DataFrame ops and unkeyed expression ops consume an unknown part of the stack
+		d.stack = d.stack[:0]
+		if op.opcode < 100 {
+			return exprEntry{id: -1}
+		}
+		entry := exprEntry{id: -1, start: pos}
+		d.stack = append(d.stack, entry)
+		return entry
+	}
+
+	children := d.stack[len(d.stack)-arity:]
+	entry := exprEntry{id: -1, start: pos}
+	if arity > 0 {
+		entry.start = children[0].start
+	}
+	key := op.key
+	for _, child := range children {
+		if child.id < 0 {
+			key = ""
+			break
+		}
+		key += "," + strconv.Itoa(child.id)
+	}
+	if key != "" {
+		if d.ids == nil {
+			d.ids = make(map[string]int)
+		}
+		id, ok := d.ids[key]
+		if !ok {
+			id = len(d.counts)
+			d.ids[key] = id
+			d.counts = append(d.counts, 0)
+			d.sizes = append(d.sizes, 0)
+		}
+		entry.id = id
+	}
+	d.stack = append(d.stack[:len(d.stack)-arity], entry)
+	return entry
+}
+
+// shared reports whether replacing the repeats of a subtree saves ops: the Dup
+// and the Loads must cost less than the ops they replace
+func (d *exprDedup) shared(id int) bool {
+	return (d.counts[id]-1)*d.sizes[id] > d.counts[id]
+}
+
+// shareSubexpressions validates the operations and rewrites repeated subexpressions
+// into ExprDup/ExprLoad references. The input is returned unchanged when nothing
+// repeats; error frames refer to the operations as built.
+func shareSubexpressions(ops []Operation) ([]Operation, error) {
+	var d exprDedup
+	for i, op := range ops {
+		if op.err != nil {
+			return nil, &Error{
+				Code:    4, // ERROR_POLARS_OPERATION
+				Message: op.err.Error(),
+				Frame:   i,
+			}
+		}
+		if entry := d.push(op, i); entry.id >= 0 {
+			d.counts[entry.id]++
+			d.sizes[entry.id] = i - entry.start + 1
+		}
+	}
+
+	worthwhile := false
+	for id := range d.counts {
+		worthwhile = worthwhile || d.shared(id)
+	}
+	if !worthwhile {
+		return ops, nil
+	}
+
+	out := make([]Operation, 0, len(ops))
+	slots := make(map[int]uint32)
+	d.stack = d.stack[:0]
+	for _, op := range ops {
+		out = append(out, op)
+		entry := d.push(op, len(out)-1)
+		if entry.id < 0 {
+			continue
+		}
+		if slot, ok := slots[entry.id]; ok {
+			out = append(out[:entry.start], slotOp(OpExprLoad, slot))
+		} else if d.shared(entry.id) {
+			slot := uint32(len(slots))
+			slots[entry.id] = slot
+			out = append(out, slotOp(OpExprDup, slot))
+		}
+	}
+	return out, nil
+}
+
+// slotOp creates an ExprDup or ExprLoad reference to a subexpression slot
+func slotOp(opcode uint32, slot uint32) Operation {
+	return Operation{
+		opcode: opcode,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.SlotArgs{slot: C.uint32_t(slot)})
+		},
+	}
+}
@@ -0,0 +1,136 @@
+package polars
+
+import (
+	"math"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// countOpcode counts the operations with the given opcode
+func countOpcode(ops []Operation, opcode uint32) int {
+	count := 0
+	for _, op := range ops {
+		if op.opcode == opcode {
+			count++
+		}
+	}
+	return count
+}
+
+// TestConstantFolding verifies literal-only arithmetic is evaluated in the builder
+func TestConstantFolding(t *testing.T) {
+	t.Run("Integers", func(t *testing.T) {
+		expr := Lit(2).Mul(Lit(3)).Add(Lit(int64(4)))
+		require.Equal(t, 1, expr.countOps())
+		require.Equal(t, int64(10), expr.lit)
+	})
+
+	t.Run("MixedNumeric", func(t *testing.T) {
+		expr := Lit(1.5).Add(Lit(1))
+		require.Equal(t, 1, expr.countOps())
+		require.Equal(t, 2.5, expr.lit)
+	})
+
+	t.Run("Logic", func(t *testing.T) {
+		expr := Lit(3).Gt(Lit(2)).And(Lit(true)).Not()
+		require.Equal(t, 1, expr.countOps())
+		require.Equal(t, false, expr.lit)
+	})
+
+	t.Run("LeftToPolars", func(t *testing.T) {
+		// Overflow, integer division and NaN comparisons keep Polars semantics
+		require.Equal(t, 3, Lit(int64(math.MaxInt64)).Add(Lit(1)).countOps())
+		require.Equal(t, 3, Lit(7).Div(Lit(2)).countOps())
+		require.Equal(t, 3, Lit(math.NaN()).Eq(Lit(math.NaN())).countOps())
+
+		// Only literal-only operands fold
+		expr := Col("salary").Add(Lit(1)).Add(Lit(2))
+		require.Equal(t, 5, expr.countOps())
+		require.Nil(t, expr.lit)
+	})
+
+	t.Run("Execution", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			Select("age").
+			WithColumns(Col("age").Add(Lit(10).Mul(Lit(2))).Alias("older")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		older := make([]int64, 7)
+		require.NoError(t, df.Int64Column("older", older, nil))
+		require.Equal(t, int64(45), older[0])
+	})
+}
+
+// TestSubexpressionSharing verifies repeated subexpressions are sent once and referenced
+func TestSubexpressionSharing(t *testing.T) {
+	bonus := func() *ExprNode { return Col("salary").Mul(Lit(1.1)) }
+
+	t.Run("Rewrite", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").WithColumns(
+			bonus().Alias("bonus"),
+			bonus().Add(Lit(100.0)).Alias("bonus_plus"),
+			bonus().Gt(Lit(60000.0)).Alias("high_bonus"),
+		)
+		defer df.Release()
+
+		ops, err := shareSubexpressions(df.operations)
+		require.NoError(t, err)
+		require.Equal(t, 1, countOpcode(ops, OpExprDup))
+		require.Equal(t, 2, countOpcode(ops, OpExprLoad))
+		require.Equal(t, 1, countOpcode(ops, OpExprColumn))
+		require.Less(t, len(ops), len(df.operations))
+	})
+
+	t.Run("NothingRepeated", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").WithColumns(
+			bonus().Alias("bonus"),
+			Col("age").Add(Lit(1)).Alias("next_age"),
+		)
+		defer df.Release()
+
+		ops, err := shareSubexpressions(df.operations)
+		require.NoError(t, err)
+		require.Equal(t, len(df.operations), len(ops))
+		require.Zero(t, countOpcode(ops, OpExprDup))
+	})
+
+	t.Run("Execution", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			WithColumns(
+				bonus().Alias("bonus"),
+				bonus().Add(Lit(100.0)).Alias("bonus_plus"),
+			).
+			Filter(bonus().Gt(Lit(60000.0))).
+			WithColumns(bonus().Sub(Lit(1.0)).Alias("bonus_minus")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("bonus")
+		require.NoError(t, err)
+		values := make(map[string][]float64)
+		for _, name := range []string{"salary", "bonus", "bonus_plus", "bonus_minus"} {
+			values[name] = make([]float64, info.Len)
+			require.NoError(t, df.Float64Column(name, values[name], nil))
+		}
+		for i, salary := range values["salary"] {
+			require.Greater(t, salary*1.1, 60000.0)
+			require.InDelta(t, salary*1.1, values["bonus"][i], 1e-6)
+			require.InDelta(t, salary*1.1+100, values["bonus_plus"][i], 1e-6)
+			require.InDelta(t, salary*1.1-1, values["bonus_minus"][i], 1e-6)
+		}
+	})
+
+	t.Run("ErrorFrame", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").
+			WithColumns(bonus().Alias("a"), bonus().Alias("b"), Col("age").Over())
+		defer df.Release()
+
+		_, err := shareSubexpressions(df.operations)
+		require.Error(t, err)
+		require.Equal(t, 10, err.(*Error).Frame) // Index as built, before any rewrite
+	})
+}
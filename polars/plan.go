@@ -0,0 +1,90 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"fmt"
+)
+
+// PreparedPlan is an operation chain decoded once on the Rust side
+// Executing it binds Param() slots to new values without re-running the Go
+// args closures or re-decoding the op stream.
+type PreparedPlan struct {
+	handle C.uintptr_t
+}
+
+// Prepare compiles the pending operations into a reusable plan
+// The operations must not end in Collect(); the plan collects on every Execute.
+// The DataFrame's own handle is left untouched and its pending operations are cleared.
+func (df *DataFrame) Prepare() (*PreparedPlan, error) {
+	if len(df.operations) == 0 {
+		return nil, errors.New("no operations to prepare")
+	}
+
+	defer func() {
+		df.operations = df.operations[:0]
+	}()
+
+	arena := &argArena{}
+	defer arena.free() // The plan keeps decoded templates, not the raw args
+	cOps, err := df.buildOperations(arena)
+	if err != nil {
+		return nil, err
+	}
+
+	result := C.prepare_operations(df.handle, &cOps[0], C.size_t(len(cOps)))
+	if err := resultError(result); err != nil {
+		return nil, err
+	}
+
+	return &PreparedPlan{handle: result.polars_handle.handle}, nil
+}
+
+// Execute binds params positionally to Param(0), Param(1), ... and collects the result
+// Supported parameter types match Lit(): int, int64, float64, string and bool.
+func (p *PreparedPlan) Execute(params ...any) (*DataFrame, error) {
+	if p.handle == 0 {
+		return nil, errors.New("prepared plan has been released")
+	}
+
+	arena := &argArena{}
+	defer arena.free()
+
+	literals := arenaSlice[C.Literal](arena, len(params))
+	for i, param := range params {
+		literal, ok := makeLiteral(arena, param)
+		if !ok {
+			return nil, fmt.Errorf("unsupported parameter type at index %d: %T", i, param)
+		}
+		literals[i] = literal
+	}
+
+	var literalsPtr *C.Literal
+	if len(literals) > 0 {
+		literalsPtr = &literals[0]
+	}
+
+	result := C.execute_prepared(p.handle, literalsPtr, C.size_t(len(literals)))
+	if err := resultError(result); err != nil {
+		return nil, err
+	}
+
+	return &DataFrame{handle: result.polars_handle}, nil
+}
+
+// Release frees the Rust-side plan
+func (p *PreparedPlan) Release() error {
+	if p.handle == 0 {
+		return nil
+	}
+
+	if C.release_prepared_plan(p.handle) != 0 {
+		return errors.New("failed to release prepared plan")
+	}
+
+	p.handle = 0
+	return nil
+}
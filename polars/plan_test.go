@@ -0,0 +1,99 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestPreparedPlans verifies prepare-once/execute-many with bound parameters
+func TestPreparedPlans(t *testing.T) {
+	t.Run("RebindLiterals", func(t *testing.T) {
+		plan, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Param(0))).
+			Select("name", "age").
+			Prepare()
+		require.NoError(t, err)
+		defer plan.Release()
+
+		result, err := plan.Execute(30)
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (2, 2)
+┌─────────┬─────┐
+│ name    ┆ age │
+│ ---     ┆ --- │
+│ str     ┆ i64 │
+╞═════════╪═════╡
+│ Charlie ┆ 35  │
+│ Eve     ┆ 32  │
+└─────────┴─────┘`
+		require.Equal(t, expected, result.String())
+
+		// Same plan, different parameter - no re-decoding of the op stream
+		result2, err := plan.Execute(33)
+		require.NoError(t, err)
+		defer result2.Release()
+
+		height, err := result2.Height()
+		require.NoError(t, err)
+		require.Equal(t, 1, height)
+	})
+
+	t.Run("StringParameters", func(t *testing.T) {
+		plan, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Param(0)).And(Col("salary").Gt(Param(1)))).
+			Count().
+			Prepare()
+		require.NoError(t, err)
+		defer plan.Release()
+
+		for _, tc := range []struct {
+			department string
+			minSalary  int
+			expected   string
+		}{
+			{"Engineering", 55000, "2"},
+			{"Sales", 0, "2"},
+			{"Marketing", 59000, "1"},
+		} {
+			result, err := plan.Execute(tc.department, tc.minSalary)
+			require.NoError(t, err)
+			csv, err := result.ToCsv()
+			require.NoError(t, err)
+			require.Equal(t, "count\n"+tc.expected+"\n", csv)
+			require.NoError(t, result.Release())
+		}
+	})
+
+	t.Run("MissingParameter", func(t *testing.T) {
+		plan, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Param(1))).
+			Prepare()
+		require.NoError(t, err)
+		defer plan.Release()
+
+		_, err = plan.Execute(30)
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "references parameter 1")
+	})
+
+	t.Run("UnsupportedParameterType", func(t *testing.T) {
+		plan, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Param(0))).
+			Prepare()
+		require.NoError(t, err)
+		defer plan.Release()
+
+		_, err = plan.Execute([]int{1})
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "unsupported parameter type")
+	})
+
+	t.Run("PrepareGroupByWithoutAgg", func(t *testing.T) {
+		_, err := ReadCSV("../testdata/sample.csv").GroupBy("department").Prepare()
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "Cannot prepare grouped data")
+	})
+}
@@ -0,0 +1,90 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"runtime"
+	"time"
+	"unsafe"
+)
+
+// FrameProfile describes one op frame of a profiled execution
+// Row counts and sizes are -1 when the frame is not materialized (lazy and
+// grouped contexts, expression ops).
+type FrameProfile struct {
+	Frame          int           // Index in the operation chain
+	Opcode         uint32        // One of the Op* constants
+	Duration       time.Duration // Wall time spent dispatching the op
+	InputRows      int
+	OutputRows     int
+	EstimatedBytes int // Estimated heap size of the result frame
+}
+
+// NodeTiming is Polars' own timing of one physical plan node recorded on collect
+// Start and End are offsets from the start of the query.
+type NodeTiming struct {
+	Name  string
+	Start time.Duration
+	End   time.Duration
+}
+
+// Profile is the execution profile of one CollectWithProfile call
+type Profile struct {
+	Frames []FrameProfile
+	Nodes  []NodeTiming
+}
+
+// CollectWithProfile materializes the result like Collect and returns an execution
+// profile: per-op wall time, row counts and sizes, plus Polars node timings for
+// the collect. The profile is also returned when execution fails, covering the
+// frames up to the failure.
+func (df *DataFrame) CollectWithProfile() (*DataFrame, *Profile, error) {
+	df.operations = append(df.operations, Operation{
+		opcode: OpCollect,
+		args:   noArgs,
+	})
+
+	var handle C.uintptr_t
+	var pinner runtime.Pinner
+	pinner.Pin(&handle)
+	defer pinner.Unpin()
+
+	options := C.ExecutionOptions{profile: &handle}
+	result, err := df.executeWith(&options)
+	if handle == 0 {
+		return result, nil, err
+	}
+	defer C.release_profile(handle)
+
+	return result, readProfile(handle), err
+}
+
+// readProfile copies a Rust profile into Go memory
+func readProfile(handle C.uintptr_t) *Profile {
+	profile := &Profile{}
+
+	var count C.size_t
+	frames := C.profile_frames(handle, &count)
+	for i, frame := range unsafe.Slice(frames, int(count)) {
+		profile.Frames = append(profile.Frames, FrameProfile{
+			Frame:          i,
+			Opcode:         uint32(frame.opcode),
+			Duration:       time.Duration(frame.wall_ns),
+			InputRows:      int(frame.input_rows),
+			OutputRows:     int(frame.output_rows),
+			EstimatedBytes: int(frame.estimated_bytes),
+		})
+	}
+
+	nodes := C.profile_nodes(handle, &count)
+	for _, node := range unsafe.Slice(nodes, int(count)) {
+		profile.Nodes = append(profile.Nodes, NodeTiming{
+			Name:  C.GoStringN(node.name.data, C.int(node.name.len)),
+			Start: time.Duration(node.start_us) * time.Microsecond,
+			End:   time.Duration(node.end_us) * time.Microsecond,
+		})
+	}
+	return profile
+}
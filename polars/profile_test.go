@@ -0,0 +1,47 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestCollectWithProfile verifies per-frame and Polars node timings are reported
+func TestCollectWithProfile(t *testing.T) {
+	t.Run("Frames", func(t *testing.T) {
+		result, profile, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Lit(28))).
+			Select("name", "age").
+			CollectWithProfile()
+		require.NoError(t, err)
+		defer result.Release()
+		require.NotNil(t, profile)
+
+		// One frame per op: ReadCsv, FilterExpr, the select expressions, SelectExpr, Collect
+		require.GreaterOrEqual(t, len(profile.Frames), 4)
+		require.Equal(t, uint32(OpReadCsv), profile.Frames[0].Opcode)
+		require.Equal(t, uint32(OpFilterExpr), profile.Frames[1].Opcode)
+		for i, frame := range profile.Frames {
+			require.Equal(t, i, frame.Frame)
+		}
+
+		collect := profile.Frames[len(profile.Frames)-1]
+		require.Equal(t, uint32(OpCollect), collect.Opcode)
+		require.Equal(t, -1, collect.InputRows) // Lazy input
+		require.Equal(t, 4, collect.OutputRows)
+		require.Greater(t, collect.EstimatedBytes, 0)
+
+		require.NotEmpty(t, profile.Nodes)
+		for _, node := range profile.Nodes {
+			require.NotEmpty(t, node.Name)
+			require.GreaterOrEqual(t, node.End, node.Start)
+		}
+	})
+
+	t.Run("ProfileOnError", func(t *testing.T) {
+		_, profile, err := ReadCSV("../testdata/sample.csv").GroupBy("department").CollectWithProfile()
+		require.Error(t, err)
+		require.NotNil(t, profile)
+		require.Equal(t, uint32(OpReadCsv), profile.Frames[0].Opcode)
+	})
+}
@@ -0,0 +1,63 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestHandleRegistry verifies handles are released by type and never leak
+func TestHandleRegistry(t *testing.T) {
+	t.Run("ChainLeavesNoIntermediates", func(t *testing.T) {
+		baseline := LiveHandles()
+
+		df, err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Lit(26))).
+			Select("name", "age").
+			Limit(3).
+			Collect()
+		require.NoError(t, err)
+		require.Equal(t, baseline+1, LiveHandles())
+
+		require.NoError(t, df.Release())
+		require.Equal(t, baseline, LiveHandles())
+	})
+
+	t.Run("ReleaseLazyAndGroupBy", func(t *testing.T) {
+		baseline := LiveHandles()
+
+		lazy, err := ReadCSV("../testdata/sample.csv").Select("name").execute()
+		require.NoError(t, err)
+		grouped, err := ReadCSV("../testdata/sample.csv").GroupBy("department").execute()
+		require.NoError(t, err)
+		require.Equal(t, baseline+2, LiveHandles())
+
+		require.NoError(t, lazy.Release())
+		require.NoError(t, grouped.Release())
+		require.Equal(t, baseline, LiveHandles())
+	})
+
+	t.Run("SharedHandle", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+
+		shared, err := df.Share()
+		require.NoError(t, err)
+		require.NoError(t, df.Release())
+
+		// The frame survives until the last holder releases it
+		height, err := shared.Height()
+		require.NoError(t, err)
+		require.Equal(t, 7, height)
+		require.NoError(t, shared.Release())
+	})
+
+	t.Run("StaleHandle", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+
+		stale := *df
+		require.NoError(t, df.Release())
+		require.Error(t, stale.Release())
+	})
+}
@@ -0,0 +1,157 @@
+package polars
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestRollingExpressions verifies rolling, cumulative and exponentially weighted kernels
+func TestRollingExpressions(t *testing.T) {
+	// Salaries in file order: 50000 60000 70000 55000 65000 58000 52000
+	column := func(t *testing.T, exprs ...*ExprNode) map[string][]float64 {
+		t.Helper()
+		df, err := ReadCSV("../testdata/sample.csv").Select(toAny(exprs)...).Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		columns := make(map[string][]float64)
+		for _, field := range schema {
+			values := make([]float64, 7)
+			require.NoError(t, df.Float64Column(field.Name, values, nil))
+			columns[field.Name] = values
+		}
+		return columns
+	}
+
+	t.Run("FixedWindows", func(t *testing.T) {
+		columns := column(t,
+			Col("salary").RollingSum(RollingWindow{WindowSize: 3, MinPeriods: 1}).Alias("sum"),
+			Col("salary").RollingMin(RollingWindow{WindowSize: 2, MinPeriods: 1}).Alias("min"),
+			Col("salary").RollingMax(RollingWindow{WindowSize: 2, MinPeriods: 1}).Alias("max"),
+			Col("salary").RollingMean(RollingWindow{WindowSize: 2, MinPeriods: 1}).Alias("mean"),
+			Col("salary").RollingStd(RollingWindow{WindowSize: 2, MinPeriods: 1}).Alias("std"),
+		)
+		require.Equal(t, []float64{50000, 110000, 180000, 185000, 190000, 178000, 175000}, columns["sum"])
+		require.Equal(t, []float64{50000, 50000, 60000, 55000, 55000, 58000, 52000}, columns["min"])
+		require.Equal(t, []float64{50000, 60000, 70000, 70000, 65000, 65000, 58000}, columns["max"])
+		require.Equal(t, []float64{50000, 55000, 65000, 62500, 60000, 61500, 55000}, columns["mean"])
+		require.InDelta(t, 5000, columns["std"][1], 1e-9) // Population std of {50000, 60000}
+	})
+
+	t.Run("MinPeriods", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			Select(Col("salary").RollingSum(RollingWindow{WindowSize: 3}).Alias("sum")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		info, err := df.ColumnInfo("sum")
+		require.NoError(t, err)
+		require.Equal(t, 2, info.NullCount) // Full windows only by default
+	})
+
+	t.Run("DurationWindows", func(t *testing.T) {
+		var csv strings.Builder
+		csv.WriteString("t,cpu\n")
+		for i := 0; i < 10; i++ {
+			fmt.Fprintf(&csv, "%d,%d\n", i, i*10)
+		}
+		path := filepath.Join(t.TempDir(), "series.csv")
+		require.NoError(t, os.WriteFile(path, []byte(csv.String()), 0o644))
+
+		df, err := ReadCSV(path).
+			Select(Col("cpu").RollingSum(RollingWindow{By: "t", Duration: "3i"}).Alias("sum")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		values := make([]float64, 10)
+		require.NoError(t, df.Float64Column("sum", values, nil))
+		require.Equal(t, []float64{0, 10, 30, 60, 90, 120, 150, 180, 210, 240}, values)
+	})
+
+	t.Run("Cumulative", func(t *testing.T) {
+		columns := column(t,
+			Col("salary").CumSum().Alias("sum"),
+			Col("salary").CumMin().Alias("min"),
+			Col("salary").CumMax().Alias("max"),
+		)
+		require.Equal(t, []float64{50000, 110000, 180000, 235000, 300000, 358000, 410000}, columns["sum"])
+		require.Equal(t, []float64{50000, 50000, 50000, 50000, 50000, 50000, 50000}, columns["min"])
+		require.Equal(t, []float64{50000, 60000, 70000, 70000, 70000, 70000, 70000}, columns["max"])
+	})
+
+	t.Run("CumulativeOverPartitions", func(t *testing.T) {
+		columns := column(t, Col("salary").CumSum().Over("department").Alias("sum"))
+		require.Equal(t, []float64{50000, 60000, 120000, 55000, 185000, 118000, 107000}, columns["sum"])
+	})
+
+	t.Run("Ewm", func(t *testing.T) {
+		columns := column(t,
+			Col("salary").EwmMean(EwmOptions{Alpha: 0.5}).Alias("alpha"),
+			Col("salary").EwmMean(EwmOptions{Span: 3}).Alias("span"), // Same alpha
+			Col("salary").EwmStd(EwmOptions{Alpha: 0.5, Adjust: true}).Alias("std"),
+		)
+		// Recursive form: y[i] = y[i-1] + alpha * (x[i] - y[i-1])
+		require.Equal(t, []float64{50000, 55000, 62500}, columns["alpha"][:3])
+		require.Equal(t, columns["alpha"], columns["span"])
+		require.Greater(t, columns["std"][2], 0.0)
+	})
+
+	t.Run("InvalidOptions", func(t *testing.T) {
+		invalid := []*ExprNode{
+			Col("salary").RollingSum(RollingWindow{}),
+			Col("salary").RollingSum(RollingWindow{By: "age"}),
+			Col("salary").RollingMean(RollingWindow{WindowSize: 3, MinPeriods: -1}),
+			Col("salary").RollingStd(RollingWindow{WindowSize: 3}, 2),
+			Col("salary").EwmMean(EwmOptions{}),
+			Col("salary").EwmMean(EwmOptions{Alpha: 1.5}),
+			Col("salary").EwmMean(EwmOptions{Alpha: 0.5, Span: 3}),
+			Col("salary").EwmStd(EwmOptions{Span: 0.5}),
+		}
+		for _, expr := range invalid {
+			_, err := ReadCSV("../testdata/sample.csv").Select(expr).Collect()
+			require.Error(t, err)
+		}
+	})
+
+	t.Run("Encoded", func(t *testing.T) {
+		query := func() *DataFrame {
+			return ReadCSV("../testdata/sample.csv").Select(
+				Col("salary").RollingMean(RollingWindow{WindowSize: 2, MinPeriods: 1}).Alias("mean"),
+				Col("salary").CumSum().Alias("sum"),
+				Col("salary").EwmMean(EwmOptions{Alpha: 0.5}).Alias("ewm"),
+			)
+		}
+		program, err := query().Encode()
+		require.NoError(t, err)
+
+		direct, err := query().Collect()
+		require.NoError(t, err)
+		defer direct.Release()
+		decoded, err := ExecuteEncoded(program)
+		require.NoError(t, err)
+		defer decoded.Release()
+		collected, err := decoded.Collect()
+		require.NoError(t, err)
+		defer collected.Release()
+
+		require.Equal(t, direct.String(), collected.String())
+	})
+}
+
+// toAny converts expressions to Select arguments
+func toAny(exprs []*ExprNode) []any {
+	args := make([]any, len(exprs))
+	for i, expr := range exprs {
+		args[i] = expr
+	}
+	return args
+}
@@ -0,0 +1,43 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"unsafe"
+)
+
+// Schema returns the column names and types of the DataFrame without collecting it
+// Pending operations are executed first, which for lazy pipelines only builds the
+// plan: the schema is resolved from it, so scans read file metadata but no rows.
+// Types without a DataType constant (lists, structs...) are reported as 0.
+func (df *DataFrame) Schema() ([]ColumnType, error) {
+	if len(df.operations) > 0 {
+		if _, err := df.execute(); err != nil {
+			return nil, err
+		}
+	}
+	if df.handle.handle == 0 {
+		return nil, errors.New("no operations to inspect")
+	}
+
+	var buffer C.SchemaBuffer
+	if rc := C.dataframe_schema(df.handle, &buffer); rc != 0 {
+		message := C.GoString(buffer.error)
+		C.free_string(buffer.error)
+		return nil, &Error{Code: int(rc), Message: message}
+	}
+	defer C.release_schema(buffer.owner)
+
+	fields := unsafe.Slice(buffer.fields, int(buffer.count))
+	columns := make([]ColumnType, len(fields))
+	for i, field := range fields {
+		columns[i] = ColumnType{
+			Name: C.GoStringN(field.name.data, C.int(field.name.len)),
+			Type: DataType(field.dtype),
+		}
+	}
+	return columns, nil
+}
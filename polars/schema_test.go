@@ -0,0 +1,67 @@
+package polars
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestSchema verifies schema introspection for lazy, collected and grouped frames
+func TestSchema(t *testing.T) {
+	expected := []ColumnType{
+		{Name: "name", Type: String},
+		{Name: "age", Type: Int64},
+		{Name: "salary", Type: Int64},
+		{Name: "department", Type: String},
+	}
+
+	t.Run("LazyFrame", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv")
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		require.Equal(t, expected, schema)
+		require.NotEqual(t, contextDataFrame, int(df.handle.context_type)) // Nothing was collected
+	})
+
+	t.Run("DataFrame", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").
+			WithColumns(Col("salary").Cast(Float64).Alias("salary_f")).
+			Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		require.Len(t, schema, 5)
+		require.Equal(t, ColumnType{Name: "salary_f", Type: Float64}, schema[4])
+	})
+
+	t.Run("Parquet", func(t *testing.T) {
+		df := ReadParquet("../testdata/fortune1000_2024.parquet").Select("Rank", "Company")
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		require.Len(t, schema, 2)
+		require.Equal(t, "Company", schema[1].Name)
+	})
+
+	t.Run("GroupBy", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").GroupBy("department")
+		defer df.Release()
+
+		schema, err := df.Schema()
+		require.NoError(t, err)
+		require.Equal(t, []ColumnType{{Name: "department", Type: String}}, schema)
+	})
+
+	t.Run("InvalidPlan", func(t *testing.T) {
+		df := ReadCSV("../testdata/sample.csv").Select("missing_column")
+		defer df.Release()
+
+		_, err := df.Schema()
+		require.Error(t, err)
+	})
+}
@@ -0,0 +1,148 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"unsafe"
+)
+
+// Compression selects the codec used by the sink operations
+// Using C constants to keep in sync with Rust definitions
+type Compression = C.SinkCompression
+
+const (
+	CompressionUncompressed = C.SinkCompressionUncompressed
+	CompressionSnappy       = C.SinkCompressionSnappy // Parquet only
+	CompressionGzip         = C.SinkCompressionGzip   // Parquet only
+	CompressionLz4          = C.SinkCompressionLz4
+	CompressionZstd         = C.SinkCompressionZstd
+	CompressionBrotli       = C.SinkCompressionBrotli // Parquet only
+)
+
+// ParquetWriteOptions configures SinkParquetWithOptions
+type ParquetWriteOptions struct {
+	Compression      Compression
+	CompressionLevel int  // Codec level (0 = codec default)
+	RowGroupSize     int  // Rows per row group (0 = Polars default)
+	DataPageSize     int  // Bytes per data page (0 = Polars default)
+	Statistics       bool // Write min/max/null-count statistics used for row-group pruning
+	MaintainOrder    bool // Preserve row order in the output
+}
+
+// CsvWriteOptions configures SinkCSVWithOptions
+type CsvWriteOptions struct {
+	IncludeHeader bool
+	Separator     byte // Field separator (0 = ',')
+	BatchSize     int  // Rows serialized per batch (0 = Polars default)
+	MaintainOrder bool
+}
+
+// IpcWriteOptions configures SinkIPCWithOptions
+type IpcWriteOptions struct {
+	Compression   Compression // CompressionUncompressed, CompressionLz4 or CompressionZstd
+	MaintainOrder bool
+}
+
+// SinkParquet streams the pipeline into a Parquet file with default options
+// - compression: zstd
+// - statistics: enabled
+// - maintain_order: true
+func (df *DataFrame) SinkParquet(path string) error {
+	return df.SinkParquetWithOptions(path, ParquetWriteOptions{
+		Compression:   CompressionZstd,
+		Statistics:    true,
+		MaintainOrder: true,
+	})
+}
+
+// SinkParquetWithOptions streams the pipeline into a Parquet file
+// The data is written by the Polars streaming engine directly from Rust; it never
+// crosses into Go. Like Collect, this executes all pending operations.
+func (df *DataFrame) SinkParquetWithOptions(path string, options ParquetWriteOptions) error {
+	return df.sink(Operation{
+		opcode: OpSinkParquet,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.SinkParquetArgs{
+				path:              a.rawStr(path),
+				compression:       options.Compression,
+				compression_level: C.int32_t(options.CompressionLevel),
+				row_group_size:    C.size_t(options.RowGroupSize),
+				data_page_size:    C.size_t(options.DataPageSize),
+				statistics:        C.bool(options.Statistics),
+				maintain_order:    C.bool(options.MaintainOrder),
+			})
+		},
+	})
+}
+
+// SinkCSV streams the pipeline into a CSV file with a header row
+func (df *DataFrame) SinkCSV(path string) error {
+	return df.SinkCSVWithOptions(path, CsvWriteOptions{
+		IncludeHeader: true,
+		MaintainOrder: true,
+	})
+}
+
+// SinkCSVWithOptions streams the pipeline into a CSV file
+func (df *DataFrame) SinkCSVWithOptions(path string, options CsvWriteOptions) error {
+	return df.sink(Operation{
+		opcode: OpSinkCsv,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.SinkCsvArgs{
+				path:           a.rawStr(path),
+				include_header: C.bool(options.IncludeHeader),
+				separator:      C.uint8_t(options.Separator),
+				batch_size:     C.size_t(options.BatchSize),
+				maintain_order: C.bool(options.MaintainOrder),
+			})
+		},
+	})
+}
+
+// SinkIPC streams the pipeline into an Arrow IPC file, uncompressed
+func (df *DataFrame) SinkIPC(path string) error {
+	return df.SinkIPCWithOptions(path, IpcWriteOptions{
+		Compression:   CompressionUncompressed,
+		MaintainOrder: true,
+	})
+}
+
+// SinkIPCWithOptions streams the pipeline into an Arrow IPC file
+func (df *DataFrame) SinkIPCWithOptions(path string, options IpcWriteOptions) error {
+	return df.sink(Operation{
+		opcode: OpSinkIpc,
+		args: func(a *argArena) unsafe.Pointer {
+			return arenaNew(a, C.SinkIpcArgs{
+				path:           a.rawStr(path),
+				compression:    options.Compression,
+				maintain_order: C.bool(options.MaintainOrder),
+			})
+		},
+	})
+}
+
+// sink executes the pending operations followed by a terminal sink operation
+// Sinks produce no handle, so the DataFrame keeps its current handle (if any).
+func (df *DataFrame) sink(op Operation) error {
+	if df.handle.handle == 0 && len(df.operations) == 0 {
+		return errors.New("no data to sink")
+	}
+
+	df.operations = append(df.operations, op)
+	defer func() {
+		df.operations = df.operations[:0]
+	}()
+
+	arena := &argArena{}
+	defer arena.free()
+	cOps, err := df.buildOperations(arena)
+	if err != nil {
+		return err
+	}
+
+	result := C.execute_operations(df.handle, &cOps[0], C.size_t(len(cOps)))
+	return resultError(result)
+}
@@ -0,0 +1,103 @@
+package polars
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestSinkOperations verifies pipelines are written straight to files from Rust
+func TestSinkOperations(t *testing.T) {
+	t.Run("ParquetRoundTrip", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "engineering.parquet")
+
+		err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Engineering"))).
+			Select("name", "salary").
+			SinkParquetWithOptions(path, ParquetWriteOptions{
+				Compression:      CompressionZstd,
+				CompressionLevel: 3,
+				RowGroupSize:     2,
+				Statistics:       true,
+				MaintainOrder:    true,
+			})
+		require.NoError(t, err)
+
+		result, err := ReadParquet(path).Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		expected := `shape: (3, 2)
+┌─────────┬────────┐
+│ name    ┆ salary │
+│ ---     ┆ ---    │
+│ str     ┆ i64    │
+╞═════════╪════════╡
+│ Alice   ┆ 50000  │
+│ Charlie ┆ 70000  │
+│ Eve     ┆ 65000  │
+└─────────┴────────┘`
+
+		require.Equal(t, expected, result.String())
+	})
+
+	t.Run("CSV", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "sales.csv")
+
+		err := ReadCSV("../testdata/sample.csv").
+			Filter(Col("department").Eq(Lit("Sales"))).
+			Select("name", "age").
+			SinkCSVWithOptions(path, CsvWriteOptions{IncludeHeader: true, Separator: ';', MaintainOrder: true})
+		require.NoError(t, err)
+
+		contents, err := os.ReadFile(path)
+		require.NoError(t, err)
+		require.Equal(t, "name;age\nDiana;28\nGrace;27\n", string(contents))
+	})
+
+	t.Run("IPC", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "sample.arrow")
+
+		err := ReadCSV("../testdata/sample.csv").
+			SinkIPCWithOptions(path, IpcWriteOptions{Compression: CompressionLz4, MaintainOrder: true})
+		require.NoError(t, err)
+
+		info, err := os.Stat(path)
+		require.NoError(t, err)
+		require.Greater(t, info.Size(), int64(0))
+	})
+
+	t.Run("CollectedDataFrame", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "collected.parquet")
+
+		df, err := ReadCSV("../testdata/sample.csv").Select("name").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		require.NoError(t, df.SinkParquet(path))
+
+		// The collected handle is untouched by the sink
+		height, err := df.Height()
+		require.NoError(t, err)
+		require.Equal(t, 7, height)
+	})
+
+	t.Run("UnsupportedIPCCompression", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "bad.arrow")
+
+		err := ReadCSV("../testdata/sample.csv").
+			SinkIPCWithOptions(path, IpcWriteOptions{Compression: CompressionSnappy})
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "IPC sink does not support")
+	})
+
+	t.Run("GroupByWithoutAgg", func(t *testing.T) {
+		path := filepath.Join(t.TempDir(), "grouped.parquet")
+
+		err := ReadCSV("../testdata/sample.csv").GroupBy("department").SinkParquet(path)
+		require.Error(t, err)
+		require.Contains(t, err.Error(), "Call agg() first")
+	})
+}
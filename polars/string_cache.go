@@ -0,0 +1,42 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+
+// StringCache keeps the Polars global string cache enabled until released
+// Categorical columns created while the cache is held share one string-to-index
+// mapping, so joins, comparisons and concats of categoricals from different frames
+// compare integers instead of hashing strings. Without it, categoricals built by
+// separate reads or casts are incompatible. Hold the cache across every collect
+// that creates or combines the columns; holders nest and the cache (and its
+// memory) is dropped when the last one is released.
+type StringCache struct {
+	token C.uintptr_t
+}
+
+// EnableStringCache enables the global string cache until Release is called
+func EnableStringCache() *StringCache {
+	return &StringCache{token: C.string_cache_acquire()}
+}
+
+// Release gives up this hold on the string cache (safe to call more than once)
+func (c *StringCache) Release() {
+	if c.token != 0 {
+		C.string_cache_release(c.token)
+		c.token = 0
+	}
+}
+
+// WithStringCache runs fn with the global string cache enabled
+func WithStringCache(fn func() error) error {
+	cache := EnableStringCache()
+	defer cache.Release()
+	return fn()
+}
+
+// StringCacheEnabled reports whether any holder currently enables the string cache
+func StringCacheEnabled() bool {
+	return bool(C.string_cache_enabled())
+}
@@ -0,0 +1,48 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"errors"
+	"fmt"
+)
+
+// RegisterTable makes df available to every Query under name, replacing any
+// previous table with that name
+// The table shares df's frame without copying, so df may be released afterwards.
+// Register a collected frame for dimension tables: a lazy one keeps its plan and
+// is re-scanned by every query that reads it. Pending operations are executed
+// first. "df" is reserved for the frame a Query runs on.
+func RegisterTable(name string, df *DataFrame) error {
+	if len(df.operations) > 0 {
+		if _, err := df.execute(); err != nil {
+			return err
+		}
+	}
+	if df.handle.handle == 0 {
+		return errors.New("dataframe not executed - call Collect() first")
+	}
+
+	switch C.register_table(makeRawStr(name), df.handle.handle) {
+	case 0:
+		return nil
+	case C.ERROR_NULL_ARGS:
+		return errors.New("table name cannot be empty")
+	case C.ERROR_INVALID_UTF8:
+		return errors.New("table name is not valid UTF-8")
+	case C.ERROR_NULL_HANDLE:
+		return errors.New("invalid or released handle")
+	default:
+		return fmt.Errorf("cannot register %q: name reserved or grouped dataframe (call Agg() first)", name)
+	}
+}
+
+// UnregisterTable removes a table added by RegisterTable
+func UnregisterTable(name string) error {
+	if C.unregister_table(makeRawStr(name)) != 0 {
+		return fmt.Errorf("table %q is not registered", name)
+	}
+	return nil
+}
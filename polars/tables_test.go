@@ -0,0 +1,88 @@
+package polars
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestSQLTables verifies that registered tables are visible to Query across calls
+func TestSQLTables(t *testing.T) {
+	floorsPath := filepath.Join(t.TempDir(), "floors.csv")
+	require.NoError(t, os.WriteFile(floorsPath,
+		[]byte("department,floor\nEngineering,3\nMarketing,2\nSales,1\n"), 0o644))
+
+	t.Run("JoinRegisteredTable", func(t *testing.T) {
+		floors, err := ReadCSV(floorsPath).Collect()
+		require.NoError(t, err)
+		require.NoError(t, RegisterTable("floors", floors))
+		defer UnregisterTable("floors")
+		require.NoError(t, floors.Release()) // The registry keeps its own reference
+
+		for range 2 { // Reused by every query without reloading
+			result, err := ReadCSV("../testdata/sample.csv").Query(
+				"SELECT df.name, floors.floor FROM df " +
+					"JOIN floors ON df.department = floors.department " +
+					"WHERE floors.floor = 3 ORDER BY df.name").Collect()
+			require.NoError(t, err)
+
+			expected := `shape: (3, 2)
+┌─────────┬───────┐
+│ name    ┆ floor │
+│ ---     ┆ ---   │
+│ str     ┆ i64   │
+╞═════════╪═══════╡
+│ Alice   ┆ 3     │
+│ Charlie ┆ 3     │
+│ Eve     ┆ 3     │
+└─────────┴───────┘`
+			require.Equal(t, expected, result.String())
+			require.NoError(t, result.Release())
+		}
+	})
+
+	t.Run("LazyTable", func(t *testing.T) {
+		floors := ReadCSV(floorsPath)
+		require.NoError(t, RegisterTable("floors", floors)) // Executes the pending read
+		defer UnregisterTable("floors")
+		defer floors.Release()
+
+		result, err := ReadCSV("../testdata/sample.csv").
+			Query("SELECT COUNT(*) AS n FROM df WHERE department IN (SELECT department FROM floors WHERE floor > 1)").
+			Collect()
+		require.NoError(t, err)
+		defer result.Release()
+
+		height, err := result.Height()
+		require.NoError(t, err)
+		require.Equal(t, 1, height)
+	})
+
+	t.Run("Unregister", func(t *testing.T) {
+		floors, err := ReadCSV(floorsPath).Collect()
+		require.NoError(t, err)
+		defer floors.Release()
+
+		require.NoError(t, RegisterTable("floors", floors))
+		require.NoError(t, UnregisterTable("floors"))
+		require.Error(t, UnregisterTable("floors"))
+
+		_, err = ReadCSV("../testdata/sample.csv").Query("SELECT * FROM floors").Collect()
+		require.Error(t, err)
+	})
+
+	t.Run("InvalidRegistration", func(t *testing.T) {
+		floors, err := ReadCSV(floorsPath).Collect()
+		require.NoError(t, err)
+		defer floors.Release()
+
+		require.Error(t, RegisterTable("", floors))
+		require.Error(t, RegisterTable("df", floors)) // Reserved for the query input
+		grouped := ReadCSV(floorsPath).GroupBy("floor")
+		defer grouped.Release()
+		require.Error(t, RegisterTable("grouped", grouped))
+		require.Error(t, RegisterTable("empty", &DataFrame{}))
+	})
+}
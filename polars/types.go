@@ -29,7 +29,9 @@ const (
 	Float64 DataType = FamilyFloat | 0x0002
 	
 	// String types (0x0002_XXXX)
-	String DataType = FamilyString | 0x0001
+	String      DataType = FamilyString | 0x0001
+	Categorical DataType = FamilyString | 0x0002
+	Enum        DataType = FamilyString | 0x0003 // Fixed categories, see CastEnum
 	
 	// Temporal types (0x0003_XXXX) 
 	Date           DataType = FamilyTemporal | 0x0001
@@ -42,3 +44,9 @@ const (
 	// Boolean (0x0004_XXXX)
 	Boolean DataType = FamilyBoolean | 0x0001
 )
+
+// ColumnType pairs a column name with its data type (used for schema overrides)
+type ColumnType struct {
+	Name string
+	Type DataType
+}
@@ -0,0 +1,371 @@
+package polars
+
+/*
+#include "firn.h"
+*/
+import "C"
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"math"
+	"unsafe"
+)
+
+// Packed wire format for operation chains (decoded by rust/src/wire.rs)
+//
+//	program := magic "FIRN" version:u op*
+//	op      := opcode:u length:u payload[length]
+//
+// Payloads hold the op's args fields in declaration order: u = unsigned varint,
+// i = zigzag varint, b = one byte 0/1, f = 8 bytes little-endian, s = u length +
+// UTF-8 bytes, list = u count + items. An empty payload stands for null args
+// (Collect and GroupBy only) and FilterExpr's payload is a nested op* stream.
+// The encoding is deterministic, so equal pipelines produce equal bytes that can
+// be hashed or stored. Handles referenced by Join and Concat are process-local
+// and only valid while those frames are alive. Programs from another version are
+// rejected (see VERSION in wire.rs for the layout changes).
+
+const wireVersion = 2
+
+var wireMagic = []byte("FIRN")
+
+// Encode serializes the pending operations into the packed wire format
+// The operations are validated and shared subexpressions are rewritten exactly as
+// for execution, but nothing runs and the operations stay pending. Arrow imports
+// reference Go-owned memory and cannot be encoded, and neither can Concat inputs
+// that are still pending.
+func (df *DataFrame) Encode() ([]byte, error) {
+	if len(df.operations) == 0 {
+		return nil, errors.New("no operations to encode")
+	}
+	ops, err := shareSubexpressions(df.operations)
+	if err != nil {
+		return nil, err
+	}
+	for i, op := range df.operations {
+		if op.prepare != nil {
+			// The frames prepare builds would be released before the program runs
+			return nil, &Error{Code: 4, Message: "pending Concat inputs cannot be encoded; execute them first", Frame: i}
+		}
+	}
+
+	arena := &argArena{}
+	defer arena.free()
+	w := wireWriter{buf: append(make([]byte, 0, 16*len(ops)), wireMagic...)}
+	w.uint(wireVersion)
+	for i, op := range ops {
+		var args unsafe.Pointer
+		if op.args != nil {
+			args = op.args(arena)
+		}
+		if err := w.op(op.opcode, args); err != nil {
+			return nil, &Error{Code: 4, Message: err.Error(), Frame: i} // ERROR_POLARS_OPERATION
+		}
+	}
+	return w.buf, nil
+}
+
+// ExecuteEncoded runs a program produced by Encode, starting without an input frame
+// Programs usually begin with a read; the result is a new DataFrame.
+func ExecuteEncoded(program []byte) (*DataFrame, error) {
+	df := &DataFrame{}
+	if _, err := df.ExecuteEncoded(program); err != nil {
+		return nil, err
+	}
+	return df, nil
+}
+
+// ExecuteEncoded runs a program produced by Encode against this DataFrame
+// Pending operations are executed first. The program's string args are borrowed
+// from the buffer for the duration of the call, so nothing is copied into C memory.
+func (df *DataFrame) ExecuteEncoded(program []byte) (*DataFrame, error) {
+	if len(program) == 0 {
+		return nil, errors.New("empty program")
+	}
+	if len(df.operations) > 0 {
+		if _, err := df.execute(); err != nil {
+			return nil, err
+		}
+	}
+
+	oldHandle := df.handle.handle
+	// The buffer holds no Go pointers, so it can be passed to C without pinning
+	result := C.execute_encoded(df.handle, (*C.uint8_t)(unsafe.Pointer(&program[0])), C.size_t(len(program)))
+	return df.adopt(result, oldHandle)
+}
+
+// wireWriter appends ops in the packed wire format
+type wireWriter struct {
+	buf []byte
+}
+
+func (w *wireWriter) uint(v uint64) {
+	w.buf = binary.AppendUvarint(w.buf, v)
+}
+
+func (w *wireWriter) int(v int64) {
+	w.buf = binary.AppendVarint(w.buf, v) // Zigzag, as the decoder expects
+}
+
+func (w *wireWriter) bool(v C.bool) {
+	if v {
+		w.buf = append(w.buf, 1)
+	} else {
+		w.buf = append(w.buf, 0)
+	}
+}
+
+func (w *wireWriter) float(v float64) {
+	w.buf = binary.LittleEndian.AppendUint64(w.buf, math.Float64bits(v))
+}
+
+func (w *wireWriter) str(s C.RawStr) {
+	w.uint(uint64(s.len))
+	if s.len > 0 {
+		w.buf = append(w.buf, unsafe.Slice((*byte)(unsafe.Pointer(s.data)), int(s.len))...)
+	}
+}
+
+func (w *wireWriter) strs(values *C.RawStr, count int) {
+	w.uint(uint64(count))
+	if count > 0 {
+		for _, s := range unsafe.Slice(values, count) {
+			w.str(s)
+		}
+	}
+}
+
+// op appends one op: its opcode, then its args payload behind a length prefix
+func (w *wireWriter) op(opcode uint32, args unsafe.Pointer) error {
+	w.uint(uint64(opcode))
+	start := len(w.buf)
+	if args != nil {
+		if err := w.args(opcode, args); err != nil {
+			return err
+		}
+	}
+
+	// The payload length is only known now: shift the payload to make room for it
+	var prefix [binary.MaxVarintLen64]byte
+	n := binary.PutUvarint(prefix[:], uint64(len(w.buf)-start))
+	w.buf = append(w.buf, prefix[:n]...)
+	copy(w.buf[start+n:], w.buf[start:len(w.buf)-n])
+	copy(w.buf[start:], prefix[:n])
+	return nil
+}
+
+// args appends the payload of an op from the C args struct its builder allocated
+func (w *wireWriter) args(opcode uint32, args unsafe.Pointer) error {
+	switch opcode {
+	case OpReadCsv:
+		csv := (*C.ReadCsvArgs)(args)
+		w.str(csv.path)
+		w.bool(csv.has_header)
+		w.bool(csv.with_glob)
+		w.schema(csv.schema, int(csv.schema_count))
+		w.schema(csv.dtype_overrides, int(csv.dtype_override_count))
+		w.int(int64(csv.infer_schema_length))
+		w.uint(uint64(csv.separator))
+		w.uint(uint64(csv.quote_char))
+		w.bool(csv.disable_quoting)
+		w.uint(uint64(csv.n_rows))
+		w.uint(uint64(csv.skip_rows))
+		w.bool(csv.low_memory)
+		w.bool(csv.rechunk)
+		w.uint(uint64(csv.chunk_size))
+	case OpReadParquet:
+		parquet := (*C.ReadParquetArgs)(args)
+		w.str(parquet.path)
+		w.strs(parquet.columns, int(parquet.column_count))
+		w.uint(uint64(parquet.n_rows))
+		w.bool(parquet.parallel)
+		w.bool(parquet.with_glob)
+		w.bool(parquet.use_statistics)
+		w.uint(uint64(parquet.hive_partitioning))
+		w.bool(parquet.try_parse_hive_dates)
+		w.bool(parquet.low_memory)
+		w.bool(parquet.cache)
+		w.bool(parquet.rechunk)
+		w.str(parquet.row_index_name)
+		w.uint(uint64(parquet.row_index_offset))
+	case OpSelect:
+		selectArgs := (*C.SelectArgs)(args)
+		w.strs(selectArgs.columns, int(selectArgs.column_count))
+	case OpConcat:
+		concat := (*C.ConcatArgs)(args)
+		w.uint(uint64(concat.count))
+		if concat.count > 0 {
+			for _, handle := range unsafe.Slice(concat.handles, int(concat.count)) {
+				w.uint(uint64(handle))
+			}
+		}
+		w.uint(uint64(concat.how))
+		w.bool(concat.parallel)
+	case OpFilterExpr:
+		filter := (*C.FilterExprArgs)(args)
+		for _, op := range unsafe.Slice(filter.expr_ops, int(filter.expr_count)) {
+			// Read the args address back as a pointer; the arena is C memory, so it is stable
+			if err := w.op(uint32(op.opcode), *(*unsafe.Pointer)(unsafe.Pointer(&op.args))); err != nil {
+				return err
+			}
+		}
+	case OpGroupBy:
+		w.bool((*C.GroupByArgs)(args).maintain_order)
+	case OpGroupByDynamic:
+		dynamic := (*C.GroupByDynamicArgs)(args)
+		w.str(dynamic.index_column)
+		w.str(dynamic.every)
+		w.str(dynamic.period)
+		w.str(dynamic.offset)
+		w.uint(uint64(dynamic.closed))
+		w.uint(uint64(dynamic.label))
+		w.bool(dynamic.include_boundaries)
+	case OpRolling:
+		rolling := (*C.RollingArgs)(args)
+		w.str(rolling.index_column)
+		w.str(rolling.period)
+		w.str(rolling.offset)
+		w.uint(uint64(rolling.closed))
+	case OpSort:
+		sort := (*C.SortArgs)(args)
+		w.uint(uint64(sort.field_count))
+		if sort.field_count > 0 {
+			for _, field := range unsafe.Slice(sort.fields, int(sort.field_count)) {
+				w.str(field.column)
+				w.uint(uint64(field.direction))
+				w.uint(uint64(field.nulls_ordering))
+			}
+		}
+	case OpLimit:
+		w.uint(uint64((*C.LimitArgs)(args).n))
+	case OpQuery:
+		w.str((*C.QueryArgs)(args).sql)
+	case OpJoin:
+		w.join((*C.JoinArgs)(args))
+	case OpCollect:
+		collect := (*C.CollectArgs)(args)
+		w.bool(collect.streaming)
+		w.bool(collect.disable_predicate_pushdown)
+		w.bool(collect.disable_projection_pushdown)
+		w.bool(collect.disable_slice_pushdown)
+		w.bool(collect.disable_cse)
+	case OpSinkParquet:
+		sink := (*C.SinkParquetArgs)(args)
+		w.str(sink.path)
+		w.uint(uint64(sink.compression))
+		w.int(int64(sink.compression_level))
+		w.uint(uint64(sink.row_group_size))
+		w.uint(uint64(sink.data_page_size))
+		w.bool(sink.statistics)
+		w.bool(sink.maintain_order)
+	case OpSinkCsv:
+		sink := (*C.SinkCsvArgs)(args)
+		w.str(sink.path)
+		w.bool(sink.include_header)
+		w.uint(uint64(sink.separator))
+		w.uint(uint64(sink.batch_size))
+		w.bool(sink.maintain_order)
+	case OpSinkIpc:
+		sink := (*C.SinkIpcArgs)(args)
+		w.str(sink.path)
+		w.uint(uint64(sink.compression))
+		w.bool(sink.maintain_order)
+	case OpImportArrow:
+		return errors.New("FromArrow operations reference Go memory and cannot be encoded")
+	case OpExprColumn:
+		w.str((*C.ColumnArgs)(args).name)
+	case OpExprLiteral:
+		return w.literal(&(*C.LiteralArgs)(args).literal)
+	case OpExprAlias:
+		w.str((*C.AliasArgs)(args).name)
+	case OpExprStrContains, OpExprStrStartsWith, OpExprStrEndsWith:
+		w.str((*C.StringArgs)(args).pattern)
+	case OpExprSql:
+		w.str((*C.SqlExprArgs)(args).sql)
+	case OpExprStd, OpExprVar:
+		w.uint(uint64((*C.AggregationArgs)(args).ddof))
+	case OpExprCount, OpExprCountNulls:
+		w.bool((*C.CountArgs)(args).include_nulls)
+	case OpExprOver:
+		window := (*C.WindowArgs)(args)
+		w.strs(window.partition_columns, int(window.partition_count))
+		w.strs(window.order_columns, int(window.order_count))
+	case OpExprLag, OpExprLead:
+		w.int(int64((*C.WindowOffsetArgs)(args).offset))
+	case OpExprCast:
+		cast := (*C.CastArgs)(args)
+		w.uint(uint64(cast.dtype))
+		w.bool(cast.strict)
+		w.bool(cast.wrap_numerical)
+		w.strs(cast.categories, int(cast.category_count))
+	case OpExprRollingSum, OpExprRollingMean, OpExprRollingMin, OpExprRollingMax, OpExprRollingStd:
+		rolling := (*C.RollingExprArgs)(args)
+		w.uint(uint64(rolling.window_size))
+		w.uint(uint64(rolling.min_periods))
+		w.bool(rolling.center)
+		w.uint(uint64(rolling.ddof))
+		w.str(rolling.by)
+		w.str(rolling.duration)
+		w.uint(uint64(rolling.closed))
+	case OpExprEwmMean, OpExprEwmStd:
+		ewm := (*C.EwmArgs)(args)
+		w.float(float64(ewm.alpha))
+		w.bool(ewm.adjust)
+		w.bool(ewm.bias)
+		w.uint(uint64(ewm.min_periods))
+		w.bool(ewm.ignore_nulls)
+	case OpExprParam:
+		w.uint(uint64((*C.ParamArgs)(args).index))
+	case OpExprDup, OpExprLoad:
+		w.uint(uint64((*C.SlotArgs)(args).slot))
+	default:
+		// Ops whose args are placeholders (NewEmpty, Count) carry no payload
+	}
+	return nil
+}
+
+func (w *wireWriter) schema(fields *C.SchemaField, count int) {
+	w.uint(uint64(count))
+	if count > 0 {
+		for _, field := range unsafe.Slice(fields, count) {
+			w.str(field.name)
+			w.uint(uint64(field.dtype))
+		}
+	}
+}
+
+func (w *wireWriter) join(join *C.JoinArgs) {
+	w.uint(uint64(join.other_handle))
+	w.strs(join.left_on, int(join.column_count))
+	w.strs(join.right_on, int(join.column_count))
+	w.uint(uint64(join.how))
+	w.str(join.suffix)
+	w.bool(join.coalesce)
+	w.uint(uint64(join.validation))
+	w.bool(join.sorted_keys)
+	w.bool(join.asof != nil)
+	if join.asof != nil {
+		w.uint(uint64(join.asof.strategy))
+		w.str(join.asof.tolerance)
+		w.strs(join.asof.by, int(join.asof.by_count))
+	}
+}
+
+func (w *wireWriter) literal(literal *C.Literal) error {
+	w.uint(uint64(literal.value_type))
+	switch literal.value_type {
+	case 0:
+		w.int(int64(literal.int_value))
+	case 1:
+		w.float(float64(literal.float_value))
+	case 2:
+		w.str(literal.string_value)
+	case 3:
+		w.bool(C.bool(literal.bool_value))
+	case 4: // Null carries no value
+	default:
+		return fmt.Errorf("unsupported literal type %d", literal.value_type)
+	}
+	return nil
+}
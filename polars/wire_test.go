@@ -0,0 +1,105 @@
+package polars
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestEncodedPrograms verifies pipelines round-trip through the packed wire format
+func TestEncodedPrograms(t *testing.T) {
+	pipeline := func() *DataFrame {
+		return ReadCSV("../testdata/sample.csv").
+			Filter(Col("age").Gt(Lit(26)).And(Col("name").StrContains("a").Not())).
+			WithColumns(
+				Col("salary").Mul(Lit(1.1)).Alias("bonus"),
+				Col("salary").Mul(Lit(1.1)).Cast(Int64).Alias("bonus_int"),
+				Lit("x").Alias("tag"),
+			).
+			SortBy([]SortField{{Column: "salary", Direction: Descending}}).
+			Limit(4)
+	}
+
+	t.Run("RoundTrip", func(t *testing.T) {
+		direct, err := pipeline().Collect()
+		require.NoError(t, err)
+		defer direct.Release()
+		expected, err := direct.ToCsv()
+		require.NoError(t, err)
+
+		program, err := pipeline().Encode()
+		require.NoError(t, err)
+		require.True(t, bytes.HasPrefix(program, []byte("FIRN")))
+
+		df, err := ExecuteEncoded(program)
+		require.NoError(t, err)
+		defer df.Release()
+		df, err = df.Collect()
+		require.NoError(t, err)
+		actual, err := df.ToCsv()
+		require.NoError(t, err)
+		require.Equal(t, expected, actual)
+	})
+
+	t.Run("Deterministic", func(t *testing.T) {
+		first, err := pipeline().Encode()
+		require.NoError(t, err)
+		second, err := pipeline().Encode()
+		require.NoError(t, err)
+		require.Equal(t, first, second)
+
+		other, err := pipeline().Limit(2).Encode()
+		require.NoError(t, err)
+		require.NotEqual(t, first, other)
+	})
+
+	t.Run("KeepsPendingOperations", func(t *testing.T) {
+		df := pipeline()
+		defer df.Release()
+		_, err := df.Encode()
+		require.NoError(t, err)
+
+		height, err := df.Height()
+		require.NoError(t, err)
+		require.Equal(t, 4, height)
+	})
+
+	t.Run("AppliedToFrame", func(t *testing.T) {
+		df, err := ReadCSV("../testdata/sample.csv").Collect()
+		require.NoError(t, err)
+		defer df.Release()
+
+		program, err := (&DataFrame{}).Select("name").Limit(2).Encode()
+		require.NoError(t, err)
+		_, err = df.ExecuteEncoded(program)
+		require.NoError(t, err)
+
+		height, err := df.Height()
+		require.NoError(t, err)
+		require.Equal(t, 2, height)
+	})
+
+	t.Run("InvalidPrograms", func(t *testing.T) {
+		program, err := pipeline().Encode()
+		require.NoError(t, err)
+
+		_, err = ExecuteEncoded(program[:len(program)-1])
+		require.Error(t, err)
+
+		_, err = ExecuteEncoded([]byte("nope"))
+		require.Error(t, err)
+
+		_, err = ExecuteEncoded(nil)
+		require.Error(t, err)
+
+		// ExprLoad of slot 1000 in a one-op program is rejected while decoding
+		load := append([]byte("FIRN"), wireVersion, 0xb5, 0x01, 0x02, 0xe8, 0x07)
+		_, err = ExecuteEncoded(load)
+		require.ErrorContains(t, err, "out of range")
+
+		// Builder errors surface before encoding
+		_, err = ReadCSV("../testdata/sample.csv").WithColumns(Col("age").Over()).Encode()
+		require.Error(t, err)
+	})
+}
@@ -0,0 +1,199 @@
+use crate::{
+    ExecutionContext, FfiResult, PolarsHandle, ERROR_NULL_ARGS, ERROR_NULL_HANDLE,
+    ERROR_POLARS_OPERATION,
+};
+use polars::export::arrow::array::{Array, StructArray};
+use polars::export::arrow::datatypes::{ArrowDataType, Field as ArrowField};
+use polars::export::arrow::ffi::{
+    export_array_to_c, export_field_to_c, import_array_from_c, import_field_from_c, ArrowArray,
+    ArrowArrayStream, ArrowArrayStreamReader, ArrowSchema,
+};
+use polars::prelude::{
+    Column, CompatLevel, DataFrame, IntoSeries, PolarsError, PolarsResult, Series,
+};
+use std::os::raw::c_int;
+
+/// Arguments for importing Arrow data into a new DataFrame
+/// Either `array` + `schema` or `stream` must be set
+#[repr(C)]
+pub struct ImportArrowArgs {
+    pub array: *mut ArrowArray,        // Struct array to import (moved)
+    pub schema: *const ArrowSchema,    // Schema of the struct array (borrowed)
+    pub stream: *mut ArrowArrayStream, // Stream of struct arrays (moved)
+}
+
+/// Export a collected DataFrame through the Arrow C Data Interface
+///
+/// The frame is exported as a single struct array (one child per column), which is
+/// the layout Arrow consumers expect for a record batch. Column buffers are shared
+/// with the DataFrame rather than copied: the exported array keeps them alive until
+/// the consumer invokes the `release` callbacks, so the handle itself may be
+/// released independently.
+///
+/// Frames with multiple chunks are rechunked first; single-chunk frames (the common
+/// case after `collect`) are exported without copying any data.
+#[no_mangle]
+pub extern "C" fn dataframe_to_arrow(
+    handle: usize,
+    out_array: *mut ArrowArray,
+    out_schema: *mut ArrowSchema,
+) -> c_int {
+    if handle == 0 {
+        return ERROR_NULL_HANDLE;
+    }
+    if out_array.is_null() || out_schema.is_null() {
+        return ERROR_NULL_ARGS;
+    }
+
+    let Some(df) = crate::registry::registered_dataframe(handle) else {
+        return ERROR_NULL_HANDLE;
+    };
+    unsafe { export_dataframe(&df, out_array, out_schema) }
+}
+
+/// Export a DataFrame as a single Arrow struct array into caller-provided structs
+/// Shared by dataframe_to_arrow and the batch cursor.
+pub(crate) unsafe fn export_dataframe(
+    df: &DataFrame,
+    out_array: *mut ArrowArray,
+    out_schema: *mut ArrowSchema,
+) -> c_int {
+    // Cloning a DataFrame only bumps column reference counts
+    let series = df.clone().into_struct("".into()).into_series().rechunk();
+    if series.n_chunks() != 1 {
+        return ERROR_POLARS_OPERATION;
+    }
+
+    // Newest compat level keeps string columns as views, avoiding a conversion copy
+    let field = series.field().to_arrow(CompatLevel::newest());
+    let array = series.to_arrow(0, CompatLevel::newest());
+
+    std::ptr::write(out_schema, export_field_to_c(&field));
+    std::ptr::write(out_array, export_array_to_c(array));
+
+    0
+}
+
+/// Convert an imported Arrow struct array into a DataFrame without copying column buffers
+/// The import already applies the struct's offset to its children; children longer
+/// than the struct are cut to its rows, and null struct rows become null in every column.
+fn struct_array_to_dataframe(field: &ArrowField, array: Box<dyn Array>) -> PolarsResult<DataFrame> {
+    let fields = match field.dtype() {
+        ArrowDataType::Struct(fields) => fields,
+        dtype => {
+            return Err(PolarsError::ComputeError(
+                format!("expected an Arrow struct array, got {:?}", dtype).into(),
+            ))
+        }
+    };
+
+    let Some(struct_array) = array.as_any().downcast_ref::<StructArray>() else {
+        return Err(PolarsError::ComputeError(
+            "Arrow struct type is not backed by a struct array".into(),
+        ));
+    };
+    let rows = struct_array.len();
+    let row_validity = struct_array
+        .validity()
+        .filter(|validity| validity.unset_bits() > 0);
+
+    let columns = fields
+        .iter()
+        .zip(struct_array.values())
+        .map(|(child_field, values)| {
+            let values = match values.len() {
+                len if len == rows => values.clone(),
+                len if len > rows => values.sliced(0, rows),
+                len => {
+                    return Err(PolarsError::ComputeError(
+                        format!(
+                            "Arrow column {} has {} rows, expected {}",
+                            child_field.name, len, rows
+                        )
+                        .into(),
+                    ))
+                }
+            };
+            let values = match row_validity {
+                Some(row_validity) => {
+                    let validity = match values.validity() {
+                        Some(validity) => validity & row_validity,
+                        None => row_validity.clone(),
+                    };
+                    values.with_validity(Some(validity))
+                }
+                None => values,
+            };
+            Series::try_from((child_field.name.clone(), values)).map(Column::from)
+        })
+        .collect::<PolarsResult<Vec<_>>>()?;
+
+    DataFrame::new(columns)
+}
+
+/// Import a single struct array, taking ownership of it from the caller
+unsafe fn import_struct_array(
+    array: *mut ArrowArray,
+    schema: *const ArrowSchema,
+) -> PolarsResult<DataFrame> {
+    let field = import_field_from_c(&*schema)?;
+    // Move the array out, leaving a released (empty) struct behind per the C Data Interface
+    let array = std::ptr::replace(array, ArrowArray::empty());
+    let imported = import_array_from_c(array, field.dtype().clone())?;
+    struct_array_to_dataframe(&field, imported)
+}
+
+/// Drain an Arrow array stream into a DataFrame, keeping one chunk per batch
+unsafe fn import_array_stream(stream: *mut ArrowArrayStream) -> PolarsResult<DataFrame> {
+    let stream = Box::new(std::ptr::replace(stream, ArrowArrayStream::empty()));
+    let mut reader = ArrowArrayStreamReader::try_new(stream)?;
+    let field = reader.field().clone();
+
+    let mut result: Option<DataFrame> = None;
+    while let Some(batch) = reader.next() {
+        let df = struct_array_to_dataframe(&field, batch?)?;
+        match result.as_mut() {
+            // vstack_mut appends chunks without copying
+            Some(acc) => {
+                acc.vstack_mut(&df)?;
+            }
+            None => result = Some(df),
+        }
+    }
+
+    match result {
+        Some(df) => Ok(df),
+        None => {
+            // Empty stream - still honour the schema
+            let empty = polars::export::arrow::array::new_empty_array(field.dtype().clone());
+            struct_array_to_dataframe(&field, empty)
+        }
+    }
+}
+
+/// Dispatch function for importing Arrow data (ImportArrow opcode)
+/// Produces a DataFrame that references the caller's Arrow buffers
+pub fn dispatch_import_arrow(_handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "ImportArrowArgs cannot be null");
+    }
+
+    let args = unsafe { &*(context.operation_args as *const ImportArrowArgs) };
+    crate::cache::note_foreign_input(); // In-memory data cannot be fingerprinted
+
+    let result = if !args.array.is_null() {
+        if args.schema.is_null() {
+            return FfiResult::error(ERROR_NULL_ARGS, "Arrow schema is required with an array");
+        }
+        unsafe { import_struct_array(args.array, args.schema) }
+    } else if !args.stream.is_null() {
+        unsafe { import_array_stream(args.stream) }
+    } else {
+        return FfiResult::error(ERROR_NULL_ARGS, "Either an Arrow array or stream is required");
+    };
+
+    match result {
+        Ok(df) => FfiResult::success(df),
+        Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+    }
+}
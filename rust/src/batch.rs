@@ -0,0 +1,138 @@
+use crate::registry::{get, take, unwrap_or_clone, Frame};
+use crate::runtime::admit;
+use crate::{
+    execute_operations, free_string, FfiResult, Operation, PolarsHandle, ERROR_NULL_ARGS,
+    ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
+};
+use polars::export::rayon::prelude::*;
+use polars::prelude::{DataFrame, LazyFrame, PolarsResult};
+use polars_core::POOL;
+use std::ffi::CStr;
+use std::os::raw::c_int;
+use std::sync::Arc;
+
+/// One independent pipeline in an execute_batch call
+#[repr(C)]
+pub struct PlanDesc {
+    pub handle: PolarsHandle, // Input handle (0 for pipelines starting with a read)
+    pub operations: *const Operation, // Pipeline ops, without a trailing Collect
+    pub count: usize,
+}
+
+/// Build state of a plan before it is collected
+pub(crate) enum Pending {
+    Done(FfiResult),       // Failed while building
+    Ready(Arc<DataFrame>), // Already materialized
+    Collect(LazyFrame),    // Lazy plan still to be collected
+}
+
+/// Run the ops of one plan and resolve the result to what still has to be collected
+/// Shared by execute_batch and submit_query.
+pub(crate) fn prepare_plan(plan: &PlanDesc) -> Pending {
+    let (result_handle, owned) = if plan.count == 0 {
+        (plan.handle, false)
+    } else {
+        let result = execute_operations(plan.handle, plan.operations, plan.count);
+        if result.error_code != 0 {
+            return Pending::Done(result);
+        }
+        let owned = result.polars_handle.handle != plan.handle.handle; // Never take the caller's handle
+        (result.polars_handle, owned)
+    };
+
+    if result_handle.handle == 0 {
+        return Pending::Done(FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null"));
+    }
+
+    let frame = if owned {
+        take(result_handle.handle)
+    } else {
+        get(result_handle.handle)
+    };
+
+    match frame {
+        Some(Frame::DataFrame(df)) => Pending::Ready(df),
+        Some(Frame::LazyFrame(lf)) => Pending::Collect(unwrap_or_clone(lf)),
+        Some(Frame::LazyGroupBy(_)) => Pending::Done(FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            "Cannot collect LazyGroupBy. Call agg() first to resolve grouping.",
+        )),
+        None => Pending::Done(FfiResult::invalid_handle()),
+    }
+}
+
+/// Execute independent pipelines in one call and collect them concurrently
+///
+/// Op chains are decoded sequentially (cheap plan building), then all lazy
+/// results are collected in parallel on the Polars thread pool, the same way
+/// collect_all does. Unlike collect_all, a failing plan does not fail the batch:
+/// out_results (caller-allocated, count entries) receives one FfiResult per plan,
+/// each owning its own handle or error message. The batch counts as one call
+/// against the concurrency limit.
+#[no_mangle]
+pub extern "C" fn execute_batch(
+    plans_ptr: *const PlanDesc,
+    count: usize,
+    out_results: *mut FfiResult,
+) -> c_int {
+    if count == 0 {
+        return 0;
+    }
+    if plans_ptr.is_null() || out_results.is_null() {
+        return ERROR_NULL_ARGS;
+    }
+
+    let plans = unsafe { std::slice::from_raw_parts(plans_ptr, count) };
+    let _admission = match admit() {
+        Ok(admission) => admission,
+        Err(stopped) => {
+            // Every plan reports the interrupt, each owning a copy of the message
+            let message = unsafe { CStr::from_ptr(stopped.error_message) }
+                .to_string_lossy()
+                .into_owned();
+            free_string(stopped.error_message);
+            for i in 0..count {
+                let result = FfiResult::error(stopped.error_code, &message);
+                unsafe { std::ptr::write(out_results.add(i), result) };
+            }
+            return 0;
+        }
+    };
+
+    let mut done: Vec<Option<FfiResult>> = Vec::with_capacity(count);
+    let mut lazy: Vec<(usize, LazyFrame)> = Vec::new();
+    for (i, plan) in plans.iter().enumerate() {
+        match prepare_plan(plan) {
+            Pending::Done(result) => done.push(Some(result)),
+            Pending::Ready(df) => done.push(Some(FfiResult::success_frame(Frame::DataFrame(df)))),
+            Pending::Collect(lf) => {
+                done.push(None);
+                lazy.push((i, lf));
+            }
+        }
+    }
+
+    let collected: Vec<(usize, PolarsResult<DataFrame>)> = POOL.install(|| {
+        lazy.into_par_iter()
+            .map(|(i, lf)| (i, lf.collect()))
+            .collect()
+    });
+
+    for (i, result) in collected {
+        done[i] = Some(match result {
+            Ok(df) => FfiResult::success(df),
+            Err(e) => {
+                let mut error = FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string());
+                error.error_frame = plans[i].count; // The implicit collect after the last op
+                error
+            }
+        });
+    }
+
+    for (i, result) in done.into_iter().enumerate() {
+        if let Some(result) = result {
+            unsafe { std::ptr::write(out_results.add(i), result) };
+        }
+    }
+    0
+}
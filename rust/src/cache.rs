@@ -0,0 +1,255 @@
+use crate::wire::append_encoded;
+use crate::Operation;
+use polars::prelude::{DataFrame, LazyFrame};
+use std::cell::RefCell;
+use std::collections::{BTreeMap, HashMap};
+use std::os::raw::c_int;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::UNIX_EPOCH;
+
+/// Result cache counters, read through result_cache_stats
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct CacheStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub evictions: u64,
+    pub entries: usize,
+    pub bytes: usize,     // Estimated size of the cached frames
+    pub max_bytes: usize, // Byte budget (0 = cache disabled)
+}
+
+struct Entry {
+    frame: Arc<DataFrame>,
+    bytes: usize,
+    last_used: u64,
+}
+
+/// LRU of collected frames keyed by their fingerprint, bounded by estimated bytes
+/// Keys hold the full encoded op stream, so distinct chains never share an entry.
+#[derive(Default)]
+struct ResultCache {
+    entries: HashMap<Vec<u8>, Entry>,
+    recency: BTreeMap<u64, Vec<u8>>, // last_used tick -> key, oldest first
+    tick: u64,
+    stats: CacheStats,
+}
+
+impl ResultCache {
+    fn touch(&mut self, key: &[u8]) -> Option<Arc<DataFrame>> {
+        self.tick += 1;
+        let tick = self.tick;
+        let entry = self.entries.get_mut(key)?;
+        let key = self.recency.remove(&entry.last_used)?;
+        entry.last_used = tick;
+        self.recency.insert(tick, key);
+        Some(entry.frame.clone())
+    }
+
+    fn insert(&mut self, key: Vec<u8>, frame: Arc<DataFrame>) {
+        let bytes = frame.estimated_size();
+        if bytes > self.stats.max_bytes {
+            return; // Would evict everything and still not fit
+        }
+        if let Some(old) = self.entries.remove(&key) {
+            self.recency.remove(&old.last_used);
+            self.stats.bytes -= old.bytes;
+        }
+
+        self.tick += 1;
+        self.recency.insert(self.tick, key.clone());
+        self.entries.insert(
+            key,
+            Entry {
+                frame,
+                bytes,
+                last_used: self.tick,
+            },
+        );
+        self.stats.bytes += bytes;
+        self.evict_to_fit();
+    }
+
+    fn evict_to_fit(&mut self) {
+        while self.stats.bytes > self.stats.max_bytes {
+            let Some((_, key)) = self.recency.pop_first() else {
+                break;
+            };
+            if let Some(entry) = self.entries.remove(&key) {
+                self.stats.bytes -= entry.bytes;
+                self.stats.evictions += 1;
+            }
+        }
+        self.stats.entries = self.entries.len();
+    }
+
+    fn clear(&mut self) {
+        self.entries.clear();
+        self.recency.clear();
+        self.stats.bytes = 0;
+        self.stats.entries = 0;
+    }
+}
+
+static CACHE: Mutex<Option<ResultCache>> = Mutex::new(None);
+
+fn cache() -> std::sync::MutexGuard<'static, Option<ResultCache>> {
+    CACHE
+        .lock()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+}
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+
+/// What the op chain running on this thread has done so far
+struct Chain {
+    ops: Vec<u8>,         // Wire encoding of every op dispatched so far
+    sources: Vec<String>, // Files read by those ops
+}
+
+thread_local! {
+    /// The current chain; None once it depends on anything a fingerprint cannot
+    /// capture, or while the cache is disabled
+    static CHAIN: RefCell<Option<Chain>> = const { RefCell::new(None) };
+}
+
+/// Tracks the chain of one execute call, restoring the outer call's on drop
+pub(crate) struct SourceGuard {
+    previous: Option<Chain>,
+}
+
+impl SourceGuard {
+    /// Only chains that start from scratch (no input handle) are cacheable:
+    /// an input frame was built by an earlier call whose sources are unknown
+    pub(crate) fn begin(from_scratch: bool) -> Self {
+        let chain = (from_scratch && ENABLED.load(Ordering::Relaxed)).then(|| Chain {
+            ops: Vec::new(),
+            sources: Vec::new(),
+        });
+        SourceGuard {
+            previous: CHAIN.with(|current| current.replace(chain)),
+        }
+    }
+}
+
+impl Drop for SourceGuard {
+    fn drop(&mut self) {
+        let previous = self.previous.take();
+        CHAIN.with(|current| *current.borrow_mut() = previous);
+    }
+}
+
+/// Record an op about to be dispatched by the current chain
+/// Its encoded args (reader options, predicates, literals...) become part of the key.
+pub(crate) fn note_op(op: &Operation) {
+    CHAIN.with(|current| {
+        let mut current = current.borrow_mut();
+        if let Some(chain) = current.as_mut() {
+            if append_encoded(op, &mut chain.ops).is_err() {
+                *current = None;
+            }
+        }
+    });
+}
+
+/// Record a file read by the current chain
+pub(crate) fn note_source(path: &str) {
+    CHAIN.with(|current| {
+        if let Some(chain) = current.borrow_mut().as_mut() {
+            chain.sources.push(path.to_string());
+        }
+    });
+}
+
+/// The current chain consumed another handle or in-memory data - never cache it
+pub(crate) fn note_foreign_input() {
+    CHAIN.with(|current| *current.borrow_mut() = None);
+}
+
+/// Fingerprint of a chain: its encoded ops plus the size and mtime of every source
+/// None when the chain is not cacheable, e.g. a source is a glob, a directory or
+/// a remote URL whose state cannot be checked cheaply.
+fn fingerprint(chain: Chain) -> Option<Vec<u8>> {
+    if chain.sources.is_empty() {
+        return None;
+    }
+    let mut key = chain.ops;
+    for path in &chain.sources {
+        let metadata = std::fs::metadata(path).ok().filter(|m| m.is_file())?;
+        let mtime = metadata.modified().ok()?.duration_since(UNIX_EPOCH).ok()?;
+        key.extend_from_slice(
+            format!("\n{path}:{}:{}", metadata.len(), mtime.as_nanos()).as_bytes(),
+        );
+    }
+    Some(key)
+}
+
+/// Collect a LazyFrame through the result cache
+/// The chain is consumed by the first collect: ops after it run on a collected frame
+/// whose contents their encoding does not capture.
+pub(crate) fn collect_cached<E>(
+    lazy_frame: LazyFrame,
+    collect: impl FnOnce(LazyFrame) -> Result<DataFrame, E>,
+) -> Result<Arc<DataFrame>, E> {
+    let chain = CHAIN.with(|current| current.borrow_mut().take());
+    let key = match chain {
+        Some(chain) if cache().is_some() => fingerprint(chain),
+        _ => None,
+    };
+    let Some(key) = key else {
+        return collect(lazy_frame).map(Arc::new);
+    };
+
+    if let Some(cache) = cache().as_mut() {
+        if let Some(frame) = cache.touch(&key) {
+            cache.stats.hits += 1;
+            return Ok(frame);
+        }
+        cache.stats.misses += 1;
+    }
+
+    let frame = Arc::new(collect(lazy_frame)?);
+    if let Some(cache) = cache().as_mut() {
+        cache.insert(key, frame.clone());
+    }
+    Ok(frame)
+}
+
+/// Enable the result cache with a byte budget, or disable it with 0
+/// Shrinking the budget evicts least recently used frames; disabling drops all
+/// entries and resets the counters.
+#[no_mangle]
+pub extern "C" fn configure_result_cache(max_bytes: usize) {
+    let mut cache = cache();
+    ENABLED.store(max_bytes > 0, Ordering::Relaxed);
+    if max_bytes == 0 {
+        *cache = None;
+        return;
+    }
+    let cache = cache.get_or_insert_with(ResultCache::default);
+    cache.stats.max_bytes = max_bytes;
+    cache.evict_to_fit();
+}
+
+/// Drop all cached frames, keeping the budget and counters
+#[no_mangle]
+pub extern "C" fn clear_result_cache() {
+    if let Some(cache) = cache().as_mut() {
+        cache.clear();
+    }
+}
+
+/// Copy the result cache counters into *out (all zero while disabled)
+#[no_mangle]
+pub extern "C" fn result_cache_stats(out: *mut CacheStats) -> c_int {
+    if out.is_null() {
+        return crate::ERROR_NULL_ARGS;
+    }
+    let stats = cache()
+        .as_ref()
+        .map(|cache| cache.stats)
+        .unwrap_or_default();
+    unsafe { *out = stats };
+    0
+}
@@ -0,0 +1,226 @@
+use crate::registry::registered_dataframe;
+use crate::types::encode_data_type;
+use crate::{
+    RawStr, ERROR_INVALID_UTF8, ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
+};
+use polars::export::arrow::array::Array;
+use polars::prelude::{
+    ChunkedArray, DataType, Float64Type, Int64Type, PolarsNumericType, Series, StringChunked,
+};
+use std::os::raw::{c_int, c_void};
+
+// Bit-packed target types accepted by dataframe_copy_column (see polars/types.go)
+const INT64: u32 = 0x0000_0004;
+const FLOAT64: u32 = 0x0001_0002;
+const STRING: u32 = 0x0002_0001;
+const BOOLEAN: u32 = 0x0004_0001;
+
+/// Shape of one column, used by callers to size the buffers of dataframe_copy_column
+#[repr(C)]
+#[derive(Default)]
+pub struct ColumnInfo {
+    pub dtype: u32, // Bit-packed data type (0 when the encoding does not cover it)
+    pub len: usize,
+    pub null_count: usize,
+    pub string_bytes: usize, // UTF-8 bytes of all values of a String, Categorical or Enum column
+}
+
+/// Look up a column of a collected DataFrame by name
+fn column_series(handle: usize, name: &RawStr) -> Result<Series, c_int> {
+    if handle == 0 {
+        return Err(ERROR_NULL_HANDLE);
+    }
+    let name = unsafe { name.as_str() }.map_err(|_| ERROR_INVALID_UTF8)?;
+    let df = registered_dataframe(handle).ok_or(ERROR_NULL_HANDLE)?;
+    df.column(name)
+        .map(|column| column.as_materialized_series().clone())
+        .map_err(|_| ERROR_POLARS_OPERATION)
+}
+
+/// Strict cast to the requested type; values that do not convert fail instead of becoming null
+fn cast(series: &Series, dtype: &DataType) -> Result<Series, c_int> {
+    series
+        .strict_cast(dtype)
+        .map_err(|_| ERROR_POLARS_OPERATION)
+}
+
+fn string_bytes(ca: &StringChunked) -> usize {
+    ca.downcast_iter().map(|arr| arr.total_bytes_len()).sum()
+}
+
+/// Describe a column: its type, length, null count and string payload size
+#[no_mangle]
+pub extern "C" fn dataframe_column_info(
+    handle: usize,
+    name: RawStr,
+    out: *mut ColumnInfo,
+) -> c_int {
+    if out.is_null() {
+        return ERROR_NULL_ARGS;
+    }
+    let series = match column_series(handle, &name) {
+        Ok(series) => series,
+        Err(code) => return code,
+    };
+
+    let mut info = ColumnInfo {
+        dtype: encode_data_type(series.dtype()).unwrap_or(0),
+        len: series.len(),
+        null_count: series.null_count(),
+        string_bytes: 0,
+    };
+    if matches!(
+        series.dtype(),
+        DataType::String | DataType::Categorical(_, _) | DataType::Enum(_, _)
+    ) {
+        info.string_bytes = match cast(&series, &DataType::String) {
+            Ok(strings) => strings.str().map_or(0, string_bytes),
+            Err(code) => return code,
+        };
+    }
+    unsafe { *out = info };
+    0
+}
+
+/// View a caller buffer as `len` values, checking it holds `capacity` bytes
+unsafe fn output<'a, T>(
+    values: *mut c_void,
+    len: usize,
+    capacity: usize,
+) -> Result<&'a mut [T], c_int> {
+    if len == 0 {
+        return Ok(&mut []);
+    }
+    if values.is_null() || capacity < len * std::mem::size_of::<T>() {
+        return Err(ERROR_NULL_ARGS);
+    }
+    Ok(std::slice::from_raw_parts_mut(values as *mut T, len))
+}
+
+/// Copy the values of a numeric column chunk by chunk (one memcpy per chunk)
+unsafe fn copy_numeric<T: PolarsNumericType>(
+    series: &Series,
+    values: *mut c_void,
+    capacity: usize,
+) -> Result<(), c_int> {
+    let series = cast(series, &T::get_dtype())?;
+    let ca: &ChunkedArray<T> = series.unpack().map_err(|_| ERROR_POLARS_OPERATION)?;
+    let out = output::<T::Native>(values, ca.len(), capacity)?;
+
+    let mut row = 0;
+    for arr in ca.downcast_iter() {
+        out[row..row + arr.len()].copy_from_slice(arr.values());
+        row += arr.len();
+    }
+    Ok(())
+}
+
+/// Copy a boolean column as one byte (0 or 1) per value, the layout of a Go []bool
+unsafe fn copy_bool(series: &Series, values: *mut c_void, capacity: usize) -> Result<(), c_int> {
+    let series = cast(series, &DataType::Boolean)?;
+    let ca = series.bool().map_err(|_| ERROR_POLARS_OPERATION)?;
+    let out = output::<u8>(values, ca.len(), capacity)?;
+
+    let mut row = 0;
+    for arr in ca.downcast_iter() {
+        for (slot, value) in out[row..row + arr.len()]
+            .iter_mut()
+            .zip(arr.values().iter())
+        {
+            *slot = value as u8;
+        }
+        row += arr.len();
+    }
+    Ok(())
+}
+
+/// Copy a string column as Arrow-style offsets (len + 1 entries) plus concatenated bytes
+unsafe fn copy_strings(
+    series: &Series,
+    bytes: *mut c_void,
+    capacity: usize,
+    offsets: *mut i64,
+) -> Result<(), c_int> {
+    let series = cast(series, &DataType::String)?;
+    let ca = series.str().map_err(|_| ERROR_POLARS_OPERATION)?;
+    if offsets.is_null() || string_bytes(ca) > capacity {
+        return Err(ERROR_NULL_ARGS);
+    }
+    let offsets = std::slice::from_raw_parts_mut(offsets, ca.len() + 1);
+    let out = output::<u8>(bytes, capacity, capacity)?;
+
+    let mut end = 0;
+    offsets[0] = 0;
+    for (row, value) in ca.iter().enumerate() {
+        let value = value.unwrap_or_default(); // Null rows are empty strings
+        out[end..end + value.len()].copy_from_slice(value.as_bytes());
+        end += value.len();
+        offsets[row + 1] = end as i64;
+    }
+    Ok(())
+}
+
+/// Write the validity of a column as an LSB-first bitmap, ((len + 7) / 8) bytes
+unsafe fn write_validity(series: &Series, validity: *mut u8) {
+    if validity.is_null() {
+        return;
+    }
+    let out = std::slice::from_raw_parts_mut(validity, series.len().div_ceil(8));
+    out.fill(0);
+
+    let mut row = 0;
+    for arr in series.chunks() {
+        for i in 0..arr.len() {
+            if arr.is_valid(i) {
+                out[(row + i) / 8] |= 1 << ((row + i) % 8);
+            }
+        }
+        row += arr.len();
+    }
+}
+
+/// Copy one column of a collected DataFrame into caller-allocated buffers
+///
+/// `dtype` selects the output layout: Int64 and Float64 fill `values` with native
+/// values, Boolean with one byte per value, and String fills `values` with
+/// concatenated UTF-8 bytes plus `offsets` (len + 1 entries). Other column types are
+/// cast strictly to the requested one, so e.g. an Int32 column reads as Int64.
+/// `len` must equal the column length and `values_bytes` is the size of `values`.
+/// Values of null rows are unspecified (empty for strings); pass `validity` (or
+/// null) to receive the null bitmap.
+#[no_mangle]
+pub extern "C" fn dataframe_copy_column(
+    handle: usize,
+    name: RawStr,
+    dtype: u32,
+    len: usize,
+    values: *mut c_void,
+    values_bytes: usize,
+    offsets: *mut i64,
+    validity: *mut u8,
+) -> c_int {
+    let series = match column_series(handle, &name) {
+        Ok(series) => series,
+        Err(code) => return code,
+    };
+    if series.len() != len {
+        return ERROR_NULL_ARGS;
+    }
+
+    let copied = unsafe {
+        match dtype {
+            INT64 => copy_numeric::<Int64Type>(&series, values, values_bytes),
+            FLOAT64 => copy_numeric::<Float64Type>(&series, values, values_bytes),
+            BOOLEAN => copy_bool(&series, values, values_bytes),
+            STRING => copy_strings(&series, values, values_bytes, offsets),
+            _ => Err(ERROR_POLARS_OPERATION),
+        }
+    };
+    match copied {
+        Ok(()) => {
+            unsafe { write_validity(&series, validity) };
+            0
+        }
+        Err(code) => code,
+    }
+}
@@ -0,0 +1,113 @@
+use crate::arrow::export_dataframe;
+use crate::registry::{get, take, unwrap_or_clone, Frame};
+use crate::{
+    execute_operations, ContextType, FfiResult, Operation, PolarsHandle, ERROR_NULL_ARGS,
+    ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
+};
+use polars::export::arrow::ffi::{ArrowArray, ArrowSchema};
+use polars::prelude::DataFrame;
+use std::os::raw::c_int;
+
+/// Record-batch cursor over a materialized result
+///
+/// The whole result is collected when the cursor is opened, so peak memory is that
+/// of a plain Collect; the cursor only paginates it. Batches are zero-copy slices of
+/// the remaining frame and share the buffers of the chunk they were cut from.
+pub struct BatchCursor {
+    remaining: DataFrame,
+}
+
+/// Run an operation chain and wrap the resulting DataFrame in a batch cursor
+/// The chain must end in Collect (optionally with CollectArgs for streaming);
+/// with count == 0 the cursor is opened over a clone of the given DataFrame.
+/// The returned FfiResult carries the BatchCursor pointer in polars_handle.handle.
+#[no_mangle]
+pub extern "C" fn open_batch_cursor(
+    polars_handle: PolarsHandle,
+    operations_ptr: *const Operation,
+    count: usize,
+) -> FfiResult {
+    let (result_handle, owned) = if count == 0 {
+        (polars_handle, false)
+    } else {
+        let result = execute_operations(polars_handle, operations_ptr, count);
+        if result.error_code != 0 {
+            return result;
+        }
+        let owned = result.polars_handle.handle != polars_handle.handle; // Never take the caller's handle
+        (result.polars_handle, owned)
+    };
+
+    if result_handle.handle == 0 {
+        return FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null");
+    }
+
+    let frame = if owned {
+        take(result_handle.handle) // Intermediate result of the chain - the cursor owns it now
+    } else {
+        get(result_handle.handle)
+    };
+
+    let remaining = match frame {
+        Some(Frame::DataFrame(df)) => unwrap_or_clone(df),
+        Some(frame) => {
+            return FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                &format!(
+                    "Cannot open a batch cursor on {}. Call Collect() first.",
+                    frame.context_type().name()
+                ),
+            )
+        }
+        None => return FfiResult::invalid_handle(),
+    };
+
+    let cursor = Box::new(BatchCursor { remaining });
+    FfiResult::success_with_handle(Box::into_raw(cursor) as usize, ContextType::DataFrame)
+}
+
+/// Export the next batch of at most max_rows rows through the Arrow C Data Interface
+/// End of data is signalled the same way as ArrowArrayStream::get_next: the output
+/// array is written with a NULL release callback.
+#[no_mangle]
+pub extern "C" fn next_batch(
+    cursor_handle: usize,
+    max_rows: usize,
+    out_array: *mut ArrowArray,
+    out_schema: *mut ArrowSchema,
+) -> c_int {
+    if cursor_handle == 0 {
+        return ERROR_NULL_HANDLE;
+    }
+    if out_array.is_null() || out_schema.is_null() || max_rows == 0 {
+        return ERROR_NULL_ARGS;
+    }
+
+    let cursor = unsafe { &mut *(cursor_handle as *mut BatchCursor) };
+    let height = cursor.remaining.height();
+
+    if height == 0 {
+        unsafe {
+            std::ptr::write(out_array, ArrowArray::empty());
+            std::ptr::write(out_schema, ArrowSchema::empty());
+        }
+        return 0;
+    }
+
+    let rows = max_rows.min(height);
+    let batch = cursor.remaining.slice(0, rows);
+    cursor.remaining = cursor.remaining.slice(rows as i64, height - rows);
+
+    unsafe { export_dataframe(&batch, out_array, out_schema) }
+}
+
+/// Release a batch cursor and any rows it has not yet handed out
+#[no_mangle]
+pub extern "C" fn release_batch_cursor(cursor_handle: usize) -> c_int {
+    if cursor_handle != 0 {
+        unsafe {
+            let _ = Box::from_raw(cursor_handle as *mut BatchCursor);
+        }
+    }
+    0
+}
@@ -1,12 +1,18 @@
 use crate::{
-    execute_expr_ops, ContextType, ExecutionContext, FfiResult, JoinArgs, JoinType, LimitArgs, 
+    execute_expr_ops, AsofArgs, AsofStrategy, ContextType, ExecutionContext, FfiResult, JoinArgs,
+    JoinType, JoinValidation, LimitArgs, 
     NullsOrdering, Operation, PolarsHandle, QueryArgs, RawStr, SortArgs, SortDirection, 
     ERROR_INVALID_UTF8, ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
 };
 use polars::prelude::{DataFrame, LazyFrame, LazyGroupBy, Expr, col, len, CsvWriter, 
-    concat, UnionArgs, SortMultipleOptions, Series, Column, PolarsError, JoinArgs as PolarJoinArgs, JoinCoalesce,
-    IntoLazy, SerWriter};
-use polars_sql::SQLContext;
+    concat, concat_lf_diagonal, UnionArgs, SortMultipleOptions, Series, Column, PolarsError, JoinArgs as PolarJoinArgs, JoinCoalesce,
+    IntoLazy, SerWriter, DataType, ClosedWindow, Duration, DynamicGroupOptions,
+    Label, RollingGroupOptions, AnyValue, AsOfOptions, AsofStrategy as PolarAsofStrategy, IsSorted,
+    JoinValidation as PolarJoinValidation, PlSmallStr};
+use crate::cache::{collect_cached, note_foreign_input};
+use crate::interrupt::collect_interruptible;
+use crate::registry::{registered_dataframe, release, to_lazy, unwrap_or_clone, Frame};
+use crate::tables::{sql_context, table_count};
 use std::ffi::CString;
 use std::os::raw::{c_char, c_int};
 use std::ptr;
@@ -40,11 +46,23 @@ pub struct SelectArgs {
     pub column_count: usize,    // Number of columns
 }
 
+/// How Concat lines up the columns of its inputs
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub enum ConcatMode {
+    Vertical = 0,        // Same columns in the same order and types
+    VerticalRelaxed = 1, // Same columns, types cast to their common supertype
+    Diagonal = 2,        // Union of the columns, missing ones filled with nulls
+    DiagonalRelaxed = 3, // Diagonal, types cast to their common supertype
+}
+
 /// Arguments for concatenation operations
 #[repr(C)]
 pub struct ConcatArgs {
-    pub handles: *const usize, // Array of DataFrame handles
-    pub count: usize,          // Number of DataFrames to concatenate
+    pub handles: *const usize, // Array of DataFrame or LazyFrame handles
+    pub count: usize,          // Number of frames to concatenate
+    pub how: ConcatMode,
+    pub parallel: bool, // Run the input plans in parallel when collected
 }
 
 /// Arguments for filter operations with expressions
@@ -54,6 +72,39 @@ pub struct FilterExprArgs {
     pub expr_count: usize,          // Number of expression operations
 }
 
+/// Arguments for collect operations
+/// Null args select the default in-memory engine
+#[repr(C)]
+pub struct CollectArgs {
+    pub streaming: bool, // Run on the streaming engine (bounded memory)
+    pub disable_predicate_pushdown: bool,  // Optimizer toggles - all passes are on by default
+    pub disable_projection_pushdown: bool,
+    pub disable_slice_pushdown: bool,
+    pub disable_cse: bool, // Common subplan and subexpression elimination
+}
+
+/// Apply the optimizer toggles of CollectArgs (used by collect and explain)
+fn with_optimizations(lazy_frame: LazyFrame, args: &CollectArgs) -> LazyFrame {
+    lazy_frame
+        .with_predicate_pushdown(!args.disable_predicate_pushdown)
+        .with_projection_pushdown(!args.disable_projection_pushdown)
+        .with_slice_pushdown(!args.disable_slice_pushdown)
+        .with_comm_subplan_elim(!args.disable_cse)
+        .with_comm_subexpr_elim(!args.disable_cse)
+}
+
+/// Collect a LazyFrame, optionally on the streaming engine
+/// Honors the cancellation and deadline of the current execute call. The streaming
+/// morsel size is left to Polars (POLARS_STREAMING_CHUNK_SIZE, read from the process
+/// environment), since mutating the environment per collect would race other threads.
+fn collect_lazy(lazy_frame: LazyFrame, args: Option<&CollectArgs>) -> Result<DataFrame, FfiResult> {
+    let Some(args) = args else {
+        return collect_interruptible(lazy_frame);
+    };
+
+    collect_interruptible(with_optimizations(lazy_frame, args).with_streaming(args.streaming))
+}
+
 /// Dispatch function for creating new empty DataFrame
 pub fn dispatch_new_empty() -> FfiResult {
     let df = DataFrame::empty();
@@ -86,14 +137,14 @@ pub fn dispatch_select(handle: PolarsHandle, context: &ExecutionContext) -> FfiR
     match context_type {
         ContextType::DataFrame => {
             // Convert DataFrame to LazyFrame and select
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_frame = df.clone().lazy().select(column_exprs);
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let lazy_frame = unwrap_or_clone(df).lazy().select(column_exprs);
             FfiResult::success_lazy(lazy_frame)
         }
         ContextType::LazyFrame => {
             // Chain select operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let new_lazy_frame = lazy_frame.clone().select(column_exprs);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let new_lazy_frame = unwrap_or_clone(lazy_frame).select(column_exprs);
             FfiResult::success_lazy(new_lazy_frame)
         }
         ContextType::LazyGroupBy => {
@@ -106,13 +157,85 @@ pub fn dispatch_select(handle: PolarsHandle, context: &ExecutionContext) -> FfiR
     }
 }
 
-/// Dispatch function for group by operation
-/// Groups the DataFrame by specified expressions - this is a complete operation by itself
-pub fn dispatch_group_by(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+/// Arguments for group by operations
+/// Null args select a plain group by (group order unspecified)
+#[repr(C)]
+pub struct GroupByArgs {
+    pub maintain_order: bool, // Keep groups in order of first appearance
+}
+
+/// Window boundaries included in a group_by_dynamic or rolling window
+/// Default is left-closed for dynamic windows and right-closed for rolling ones.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub enum WindowClosed {
+    Default = 0,
+    Left = 1,
+    Right = 2,
+    Both = 3,
+    None = 4,
+}
+
+/// Which window boundary labels a group_by_dynamic group
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub enum WindowLabel {
+    Left = 0,
+    Right = 1,
+    DataPoint = 2,
+}
+
+/// Arguments for group_by_dynamic (fixed time windows)
+/// Durations use the Polars duration language, e.g. "1m", "5m", "1h", "1d12h".
+/// Extra group keys are taken from the expression stack.
+#[repr(C)]
+pub struct GroupByDynamicArgs {
+    pub index_column: RawStr, // Sorted time or integer column the windows are computed on
+    pub every: RawStr,        // Interval between window starts
+    pub period: RawStr,       // Window length (empty = every)
+    pub offset: RawStr,       // Shift of the window starts (empty = none)
+    pub closed: WindowClosed,
+    pub label: WindowLabel,
+    pub include_boundaries: bool, // Add _lower_boundary/_upper_boundary columns
+}
+
+/// Arguments for rolling (one window ending at every row)
+/// Extra group keys are taken from the expression stack.
+#[repr(C)]
+pub struct RollingArgs {
+    pub index_column: RawStr, // Sorted time or integer column the windows are computed on
+    pub period: RawStr,       // Window length
+    pub offset: RawStr,       // Shift of the window (empty = -period, i.e. windows end at the row)
+    pub closed: WindowClosed,
+}
+
+/// Resolve the input of a group by operation to a LazyFrame
+fn group_by_input(handle: PolarsHandle, operation: &str) -> std::result::Result<LazyFrame, FfiResult> {
     if handle.handle == 0 {
-        return FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null");
+        return Err(FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null"));
     }
 
+    match handle.get_context_type() {
+        Some(ContextType::DataFrame) => {
+            let Some(df) = handle.dataframe() else { return Err(FfiResult::invalid_handle()) };
+            Ok(unwrap_or_clone(df).lazy())
+        }
+        Some(ContextType::LazyFrame) => {
+            let Some(lazy_frame) = handle.lazy_frame() else { return Err(FfiResult::invalid_handle()) };
+            Ok(unwrap_or_clone(lazy_frame))
+        }
+        // Invalid operation - cannot group already grouped data
+        Some(ContextType::LazyGroupBy) => Err(FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            &format!("Cannot call {}() on already grouped data.", operation),
+        )),
+        None => Err(FfiResult::error(ERROR_POLARS_OPERATION, "Invalid context type")),
+    }
+}
+
+/// Dispatch function for group by operation
+/// Groups the DataFrame by specified expressions - this is a complete operation by itself
+pub fn dispatch_group_by(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
     // Get expressions from the expression stack (like other expression-based operations)
     let expr_stack = unsafe { &mut *context.expr_stack };
 
@@ -123,36 +246,138 @@ pub fn dispatch_group_by(handle: PolarsHandle, context: &ExecutionContext) -> Ff
         );
     }
 
+    let lazy_frame = match group_by_input(handle, "group_by") {
+        Ok(lazy_frame) => lazy_frame,
+        Err(error) => return error,
+    };
+    let maintain_order = context.operation_args != 0
+        && unsafe { (*(context.operation_args as *const GroupByArgs)).maintain_order };
+
     // Collect ALL expressions from the stack (consume them all)
     let group_exprs: Vec<_> = expr_stack.drain(..).collect();
+    let lazy_group_by = if maintain_order {
+        lazy_frame.group_by_stable(group_exprs)
+    } else {
+        lazy_frame.group_by(group_exprs)
+    };
+    FfiResult::success_lazy_group_by(lazy_group_by)
+}
 
-    // Get context type and perform operation based on current context
-    let context_type = match handle.get_context_type() {
-        Some(ct) => ct,
-        None => return FfiResult::error(ERROR_POLARS_OPERATION, "Invalid context type"),
+/// Parse a window duration; empty strings select the fallback
+pub(crate) fn window_duration(
+    raw: &RawStr,
+    name: &str,
+    fallback: Option<Duration>,
+) -> std::result::Result<Duration, FfiResult> {
+    match unsafe { raw.as_str() } {
+        Ok("") => fallback.ok_or_else(|| {
+            FfiResult::error(ERROR_NULL_ARGS, &format!("Window {} cannot be empty", name))
+        }),
+        Ok(text) => Duration::try_parse(text).map_err(|e| {
+            FfiResult::error(ERROR_POLARS_OPERATION, &format!("Invalid window {}: {}", name, e))
+        }),
+        Err(_) => Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in window duration")),
+    }
+}
+
+pub(crate) fn closed_window(closed: WindowClosed, default: ClosedWindow) -> ClosedWindow {
+    match closed {
+        WindowClosed::Default => default,
+        WindowClosed::Left => ClosedWindow::Left,
+        WindowClosed::Right => ClosedWindow::Right,
+        WindowClosed::Both => ClosedWindow::Both,
+        WindowClosed::None => ClosedWindow::None,
+    }
+}
+
+fn index_column(raw: &RawStr) -> std::result::Result<&str, FfiResult> {
+    match unsafe { raw.as_str() } {
+        Ok("") => Err(FfiResult::error(ERROR_NULL_ARGS, "Index column cannot be empty")),
+        Ok(name) => Ok(name),
+        Err(_) => Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in index column")),
+    }
+}
+
+fn dynamic_group_options(args: &GroupByDynamicArgs) -> std::result::Result<DynamicGroupOptions, FfiResult> {
+    let every = window_duration(&args.every, "every", None)?;
+    Ok(DynamicGroupOptions {
+        index_column: index_column(&args.index_column)?.into(),
+        every,
+        period: window_duration(&args.period, "period", Some(every))?,
+        offset: window_duration(&args.offset, "offset", Some(Duration::new(0)))?,
+        label: match args.label {
+            WindowLabel::Left => Label::Left,
+            WindowLabel::Right => Label::Right,
+            WindowLabel::DataPoint => Label::DataPoint,
+        },
+        include_boundaries: args.include_boundaries,
+        closed_window: closed_window(args.closed, ClosedWindow::Left),
+        ..Default::default()
+    })
+}
+
+fn rolling_group_options(args: &RollingArgs) -> std::result::Result<RollingGroupOptions, FfiResult> {
+    let period = window_duration(&args.period, "period", None)?;
+    // Windows end at the current row unless shifted
+    let default_offset = match unsafe { args.period.as_str() } {
+        Ok(text) => Duration::try_parse(&format!("-{}", text)).ok(),
+        Err(_) => None,
     };
+    Ok(RollingGroupOptions {
+        index_column: index_column(&args.index_column)?.into(),
+        period,
+        offset: window_duration(&args.offset, "offset", default_offset)?,
+        closed_window: closed_window(args.closed, ClosedWindow::Right),
+    })
+}
 
-    match context_type {
-        ContextType::DataFrame => {
-            // Convert DataFrame to LazyFrame and group by expressions
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_group_by = df.clone().lazy().group_by(group_exprs);
-            FfiResult::success_lazy_group_by(lazy_group_by)
-        }
-        ContextType::LazyFrame => {
-            // Chain group by operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let lazy_group_by = lazy_frame.clone().group_by(group_exprs);
-            FfiResult::success_lazy_group_by(lazy_group_by)
-        }
-        ContextType::LazyGroupBy => {
-            // Invalid operation - cannot group already grouped data
-            FfiResult::error(
-                ERROR_POLARS_OPERATION,
-                "Cannot call group_by() on already grouped data.",
-            )
-        }
+/// Dispatch function for group_by_dynamic
+/// Buckets a sorted index column into fixed windows directly, without computing
+/// truncated keys first; Polars walks the sorted index to find window slices.
+pub fn dispatch_group_by_dynamic(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "GroupByDynamicArgs cannot be null");
+    }
+    let args = unsafe { &*(context.operation_args as *const GroupByDynamicArgs) };
+
+    let options = match dynamic_group_options(args) {
+        Ok(options) => options,
+        Err(error) => return error,
+    };
+
+    let lazy_frame = match group_by_input(handle, "group_by_dynamic") {
+        Ok(lazy_frame) => lazy_frame,
+        Err(error) => return error,
+    };
+    let expr_stack = unsafe { &mut *context.expr_stack };
+    let group_exprs: Vec<_> = expr_stack.drain(..).collect();
+
+    let index = col(options.index_column.clone());
+    FfiResult::success_lazy_group_by(lazy_frame.group_by_dynamic(index, group_exprs, options))
+}
+
+/// Dispatch function for rolling
+/// Builds one window per row of a sorted index column (e.g. "last 5 minutes" at every event)
+pub fn dispatch_rolling(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "RollingArgs cannot be null");
     }
+    let args = unsafe { &*(context.operation_args as *const RollingArgs) };
+
+    let options = match rolling_group_options(args) {
+        Ok(options) => options,
+        Err(error) => return error,
+    };
+
+    let lazy_frame = match group_by_input(handle, "rolling") {
+        Ok(lazy_frame) => lazy_frame,
+        Err(error) => return error,
+    };
+    let expr_stack = unsafe { &mut *context.expr_stack };
+    let group_exprs: Vec<_> = expr_stack.drain(..).collect();
+
+    let index = col(options.index_column.clone());
+    FfiResult::success_lazy_group_by(lazy_frame.rolling(index, group_exprs, options))
 }
 
 /// Dispatch function for aggregation operations on LazyGroupBy
@@ -188,8 +413,8 @@ pub fn dispatch_agg(handle: PolarsHandle, context: &ExecutionContext) -> FfiResu
     let agg_exprs = expr_stack.drain(..).collect::<Vec<_>>();
 
     // Apply aggregations to LazyGroupBy
-    let lazy_group_by = unsafe { &*(handle.handle as *const LazyGroupBy) };
-    let result_lazy_frame = lazy_group_by.clone().agg(agg_exprs);
+    let Some(lazy_group_by) = handle.lazy_group_by() else { return FfiResult::invalid_handle() };
+    let result_lazy_frame = unwrap_or_clone(lazy_group_by).agg(agg_exprs);
 
     FfiResult::success_lazy(result_lazy_frame)
 }
@@ -238,12 +463,12 @@ pub fn dispatch_sort(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
 
     match context_type {
         ContextType::DataFrame => {
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
             // Use the newer sort API with SortMultipleOptions
             let sort_options = SortMultipleOptions::default()
                 .with_order_descending_multi(descending.clone())
                 .with_nulls_last_multi(nulls_last.clone());
-            let sorted_df = df.clone().sort(columns, sort_options);
+            let sorted_df = unwrap_or_clone(df).sort(columns, sort_options);
 
             match sorted_df {
                 Ok(result) => FfiResult::success(result),
@@ -251,12 +476,12 @@ pub fn dispatch_sort(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
             }
         }
         ContextType::LazyFrame => {
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
             // Use the newer sort API with SortMultipleOptions
             let sort_options = SortMultipleOptions::default()
                 .with_order_descending_multi(descending.clone())
                 .with_nulls_last_multi(nulls_last.clone());
-            let sorted_lazy = lazy_frame.clone().sort(columns, sort_options);
+            let sorted_lazy = unwrap_or_clone(lazy_frame).sort(columns, sort_options);
 
             FfiResult::success_lazy(sorted_lazy)
         }
@@ -291,13 +516,13 @@ pub fn dispatch_limit(handle: PolarsHandle, context: &ExecutionContext) -> FfiRe
     // Apply limit based on context type
     match context_type {
         ContextType::DataFrame => {
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let limited_df = df.clone().head(Some(args.n));
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let limited_df = unwrap_or_clone(df).head(Some(args.n));
             FfiResult::success(limited_df)
         }
         ContextType::LazyFrame => {
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let limited_lazy = lazy_frame.clone().limit(args.n as u32);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let limited_lazy = unwrap_or_clone(lazy_frame).limit(args.n as u32);
             FfiResult::success_lazy(limited_lazy)
         }
         ContextType::LazyGroupBy => FfiResult::error(
@@ -322,14 +547,14 @@ pub fn dispatch_count(handle: PolarsHandle) -> FfiResult {
     match context_type {
         ContextType::DataFrame => {
             // Convert DataFrame to LazyFrame and count
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_frame = df.clone().lazy().select([len().alias("count")]);
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let lazy_frame = unwrap_or_clone(df).lazy().select([len().alias("count")]);
             FfiResult::success_lazy(lazy_frame)
         }
         ContextType::LazyFrame => {
             // Chain count operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let new_lazy_frame = lazy_frame.clone().select([len().alias("count")]);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let new_lazy_frame = unwrap_or_clone(lazy_frame).select([len().alias("count")]);
             FfiResult::success_lazy(new_lazy_frame)
         }
         ContextType::LazyGroupBy => {
@@ -342,7 +567,9 @@ pub fn dispatch_count(handle: PolarsHandle) -> FfiResult {
     }
 }
 
-/// Concatenate multiple DataFrames vertically (union)
+/// Concatenate multiple frames (union) into a LazyFrame
+/// Inputs stay lazy, so a filter or projection after the concat is pushed down into
+/// every input plan (e.g. row-group pruning in each Parquet scan).
 /// Note: _handle is unused as this follows functional style concat(df1, df2, df3)
 /// rather than method style df1.concat(df2, df3)
 pub fn dispatch_concat(_handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
@@ -352,24 +579,34 @@ pub fn dispatch_concat(_handle: PolarsHandle, context: &ExecutionContext) -> Ffi
         return FfiResult::error(ERROR_NULL_ARGS, "Concat handles cannot be null or empty");
     }
 
-    // Convert handle array to DataFrames
+    note_foreign_input(); // Inputs come from other chains
+
+    // Convert handle array to LazyFrames
     let handles = unsafe { std::slice::from_raw_parts(args.handles, args.count) };
-    let mut dataframes = Vec::new();
+    let mut inputs = Vec::with_capacity(handles.len());
 
     for &handle in handles {
         if handle == 0 {
             return FfiResult::error(ERROR_NULL_HANDLE, "DataFrame handle cannot be null");
         }
-        let df = unsafe { &*(handle as *const DataFrame) };
-        dataframes.push(df.clone().lazy());
+        match to_lazy(handle) {
+            Some(lazy_frame) => inputs.push(lazy_frame),
+            None => return FfiResult::invalid_handle(),
+        }
     }
 
-    // Concatenate all DataFrames
-    match concat(dataframes, UnionArgs::default()) {
-        Ok(lazy_frame) => match lazy_frame.collect() {
-            Ok(df) => FfiResult::success(df),
-            Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
-        },
+    let union_args = UnionArgs {
+        parallel: args.parallel,
+        to_supertypes: matches!(args.how, ConcatMode::VerticalRelaxed | ConcatMode::DiagonalRelaxed),
+        ..Default::default()
+    };
+    let result = match args.how {
+        ConcatMode::Vertical | ConcatMode::VerticalRelaxed => concat(inputs, union_args),
+        ConcatMode::Diagonal | ConcatMode::DiagonalRelaxed => concat_lf_diagonal(inputs, union_args),
+    };
+
+    match result {
+        Ok(lazy_frame) => FfiResult::success_lazy(lazy_frame),
         Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
     }
 }
@@ -401,14 +638,14 @@ pub fn dispatch_select_expr(handle: PolarsHandle, context: &ExecutionContext) ->
     match context_type {
         ContextType::DataFrame => {
             // Convert DataFrame to LazyFrame and select expressions
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_frame = df.clone().lazy().select(exprs);
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let lazy_frame = unwrap_or_clone(df).lazy().select(exprs);
             FfiResult::success_lazy(lazy_frame)
         }
         ContextType::LazyFrame => {
             // Chain select operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let new_lazy_frame = lazy_frame.clone().select(exprs);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let new_lazy_frame = unwrap_or_clone(lazy_frame).select(exprs);
             FfiResult::success_lazy(new_lazy_frame)
         }
         ContextType::LazyGroupBy => {
@@ -448,14 +685,14 @@ pub fn dispatch_with_column(handle: PolarsHandle, context: &ExecutionContext) ->
     match context_type {
         ContextType::DataFrame => {
             // Convert DataFrame to LazyFrame and add columns
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_frame = df.clone().lazy().with_columns(exprs);
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let lazy_frame = unwrap_or_clone(df).lazy().with_columns(exprs);
             FfiResult::success_lazy(lazy_frame)
         }
         ContextType::LazyFrame => {
             // Chain with_columns operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let new_lazy_frame = lazy_frame.clone().with_columns(exprs);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let new_lazy_frame = unwrap_or_clone(lazy_frame).with_columns(exprs);
             FfiResult::success_lazy(new_lazy_frame)
         }
         ContextType::LazyGroupBy => {
@@ -501,14 +738,14 @@ pub fn dispatch_filter_expr(handle: PolarsHandle, context: &ExecutionContext) ->
     match context_type {
         ContextType::DataFrame => {
             // Convert DataFrame to LazyFrame and apply filter
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            let lazy_frame = df.clone().lazy().filter(filter_expr);
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let lazy_frame = unwrap_or_clone(df).lazy().filter(filter_expr);
             FfiResult::success_lazy(lazy_frame)
         }
         ContextType::LazyFrame => {
             // Chain filter operation on existing LazyFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            let new_lazy_frame = lazy_frame.clone().filter(filter_expr);
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let new_lazy_frame = unwrap_or_clone(lazy_frame).filter(filter_expr);
             FfiResult::success_lazy(new_lazy_frame)
         }
         ContextType::LazyGroupBy => {
@@ -522,6 +759,18 @@ pub fn dispatch_filter_expr(handle: PolarsHandle, context: &ExecutionContext) ->
 }
 
 /// Dispatch function for join operations
+/// Escape a column name for use inside a column-selection regex
+fn escape_regex(name: &str) -> String {
+    let mut escaped = String::with_capacity(name.len());
+    for c in name.chars() {
+        if "\\.+*?()|[]{}^$#&-~".contains(c) {
+            escaped.push('\\');
+        }
+        escaped.push(c);
+    }
+    escaped
+}
+
 pub fn dispatch_join(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
     if handle.handle == 0 {
         return FfiResult::error(ERROR_NULL_HANDLE, "Left handle cannot be null");
@@ -532,6 +781,7 @@ pub fn dispatch_join(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
     if args.other_handle == 0 {
         return FfiResult::error(ERROR_NULL_HANDLE, "Right handle cannot be null");
     }
+    note_foreign_input(); // The right side comes from another chain
 
     // Convert join type to Polars JoinType first to check if it's a cross join
     let join_how = match args.how {
@@ -540,6 +790,12 @@ pub fn dispatch_join(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
         JoinType::Right => polars::prelude::JoinType::Right,
         JoinType::Outer => polars::prelude::JoinType::Full, // Polars uses "Full" instead of "Outer"
         JoinType::Cross => polars::prelude::JoinType::Cross,
+        JoinType::Semi => polars::prelude::JoinType::Semi,
+        JoinType::Anti => polars::prelude::JoinType::Anti,
+        JoinType::AsOf => match unsafe { asof_options(args.asof) } {
+            Ok(options) => polars::prelude::JoinType::AsOf(options),
+            Err(error) => return error,
+        },
     };
 
     // For cross joins, we don't need join columns
@@ -585,55 +841,100 @@ pub fn dispatch_join(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
         None
     };
 
-    match left_context_type {
-        ContextType::DataFrame => {
-            // Both DataFrames - convert to LazyFrames for join, then collect
-            let left_df = unsafe { &*(handle.handle as *const DataFrame) };
-            let right_df = unsafe { &*(args.other_handle as *const DataFrame) };
+    // Create JoinArgs for Polars - use the builder pattern
+    let mut polars_join_args = PolarJoinArgs::new(join_how).with_validation(match args.validation {
+        JoinValidation::ManyToMany => PolarJoinValidation::ManyToMany,
+        JoinValidation::ManyToOne => PolarJoinValidation::ManyToOne,
+        JoinValidation::OneToMany => PolarJoinValidation::OneToMany,
+        JoinValidation::OneToOne => PolarJoinValidation::OneToOne,
+    });
+
+    // Output name of a right column that clashes with a left one
+    let right_suffix = suffix.clone().unwrap_or_else(|| "_right".to_string());
+    if let Some(suffix_str) = suffix {
+        polars_join_args = polars_join_args.with_suffix(Some(suffix_str.into()));
+    }
 
-            let left_lazy = left_df.clone().lazy();
-            let right_lazy = right_df.clone().lazy();
+    if args.coalesce {
+        polars_join_args = polars_join_args.with_coalesce(JoinCoalesce::CoalesceColumns);
+    }
 
-            // Create JoinArgs for Polars - use the builder pattern
-            let mut polars_join_args = PolarJoinArgs::new(join_how);
+    // Sorted keys: set the sorted flag on the leading key column of each side. The
+    // flag is metadata, not a join strategy: it does not skip the hash build in
+    // general, it only lets the code paths that consult it trust the order instead
+    // of checking it. Later keys are only sorted within runs of the leading one, so
+    // they stay unflagged.
+    let sorted_key = |keys: &[Expr]| match keys.first() {
+        Some(Expr::Column(name)) if args.sorted_keys => Some(name.clone()),
+        _ => None,
+    };
+    let (left_sorted, right_sorted) = (sorted_key(&left_on_exprs), sorted_key(&right_on_exprs));
+    let mark_sorted = |lazy_frame: LazyFrame, key: &Option<PlSmallStr>| match key {
+        Some(name) => lazy_frame.with_column(col(name.clone()).set_sorted_flag(IsSorted::Ascending)),
+        None => lazy_frame,
+    };
 
-            if let Some(suffix_str) = suffix {
-                polars_join_args = polars_join_args.with_suffix(Some(suffix_str.into()));
-            }
+    // The flag asserts the order of the inputs only: clear it on the output key
+    // columns, since right and full joins do not keep that order and a stale flag
+    // would let later operators trust it. Which of the key names survive (coalesced,
+    // or the right key suffixed on a clash) depends on the join type and on the
+    // other columns, so they are matched by an anchored regex, which expands to the
+    // names that exist when the plan is resolved and needs no schema here.
+    let unmark_sorted = |joined: LazyFrame| -> LazyFrame {
+        let mut names: Vec<String> = Vec::new();
+        if let Some(name) = &left_sorted {
+            names.push(name.to_string());
+        }
+        if let Some(name) = &right_sorted {
+            names.push(name.to_string());
+            names.push(format!("{}{}", name, right_suffix));
+        }
+        if names.is_empty() {
+            return joined;
+        }
 
-            if args.coalesce {
-                polars_join_args = polars_join_args.with_coalesce(JoinCoalesce::CoalesceColumns);
-            }
+        names.sort();
+        names.dedup();
+        let alternatives: Vec<String> = names.iter().map(|name| escape_regex(name)).collect();
+        let keys = col(format!("^({})$", alternatives.join("|")));
+        joined.with_column(keys.set_sorted_flag(IsSorted::Not))
+    };
+
+    match left_context_type {
+        ContextType::DataFrame => {
+            // Both DataFrames - convert to LazyFrames for join, then collect
+            let Some(left_df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            let Some(right_lazy) = to_lazy(args.other_handle) else {
+                return FfiResult::invalid_handle();
+            };
+
+            let left_lazy = mark_sorted(unwrap_or_clone(left_df).lazy(), &left_sorted);
+            let right_lazy = mark_sorted(right_lazy, &right_sorted);
 
             // Perform the join
             let joined_lazy = left_lazy.join(right_lazy, left_on_exprs, right_on_exprs, polars_join_args);
+            let joined_lazy = unmark_sorted(joined_lazy);
 
             // Collect to DataFrame
-            match joined_lazy.collect() {
+            match collect_interruptible(joined_lazy) {
                 Ok(result_df) => FfiResult::success(result_df),
-                Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+                Err(error) => error,
             }
         }
         ContextType::LazyFrame => {
             // Both LazyFrames - join directly
-            let left_lazy = unsafe { &*(handle.handle as *const LazyFrame) };
-            let right_lazy = unsafe { &*(args.other_handle as *const LazyFrame) };
-
-            // Create JoinArgs for Polars - use the builder pattern
-            let mut polars_join_args = PolarJoinArgs::new(join_how);
-
-            if let Some(suffix_str) = suffix {
-                polars_join_args = polars_join_args.with_suffix(Some(suffix_str.into()));
-            }
+            let Some(left_lazy) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            let Some(right_lazy) = to_lazy(args.other_handle) else {
+                return FfiResult::invalid_handle();
+            };
 
-            if args.coalesce {
-                polars_join_args = polars_join_args.with_coalesce(JoinCoalesce::CoalesceColumns);
-            }
+            let left_lazy = mark_sorted(unwrap_or_clone(left_lazy), &left_sorted);
+            let right_lazy = mark_sorted(right_lazy, &right_sorted);
 
             // Perform the join
-            let joined_lazy = left_lazy.clone().join(right_lazy.clone(), left_on_exprs, right_on_exprs, polars_join_args);
+            let joined_lazy = left_lazy.join(right_lazy, left_on_exprs, right_on_exprs, polars_join_args);
 
-            FfiResult::success_lazy(joined_lazy)
+            FfiResult::success_lazy(unmark_sorted(joined_lazy))
         }
         ContextType::LazyGroupBy => {
             // Invalid operation - cannot join grouped data without aggregation
@@ -645,6 +946,48 @@ pub fn dispatch_join(handle: PolarsHandle, context: &ExecutionContext) -> FfiRes
     }
 }
 
+/// Decode AsofArgs into Polars asof options
+/// A numeric tolerance applies to numeric keys; anything else is parsed by Polars
+/// as a duration for temporal keys.
+unsafe fn asof_options(asof: *const AsofArgs) -> std::result::Result<AsOfOptions, FfiResult> {
+    if asof.is_null() {
+        return Err(FfiResult::error(ERROR_NULL_ARGS, "AsofArgs cannot be null for an asof join"));
+    }
+    let asof = &*asof;
+
+    let mut options = AsOfOptions {
+        strategy: match asof.strategy {
+            AsofStrategy::Backward => PolarAsofStrategy::Backward,
+            AsofStrategy::Forward => PolarAsofStrategy::Forward,
+            AsofStrategy::Nearest => PolarAsofStrategy::Nearest,
+        },
+        ..Default::default()
+    };
+
+    match asof.tolerance.as_str() {
+        Ok("") => {}
+        Ok(text) => {
+            if let Ok(value) = text.parse::<i64>() {
+                options.tolerance = Some(AnyValue::Int64(value));
+            } else if let Ok(value) = text.parse::<f64>() {
+                options.tolerance = Some(AnyValue::Float64(value));
+            } else {
+                options.tolerance_str = Some(text.into());
+            }
+        }
+        Err(_) => return Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in asof tolerance")),
+    }
+
+    if asof.by_count > 0 {
+        let by = raw_str_array_to_vec(asof.by, asof.by_count)
+            .map_err(|msg| FfiResult::error(ERROR_NULL_ARGS, msg))?;
+        let by: Vec<PlSmallStr> = by.into_iter().map(PlSmallStr::from).collect();
+        options.left_by = Some(by.clone());
+        options.right_by = Some(by);
+    }
+    Ok(options)
+}
+
 /// Convert DataFrame to CSV string
 #[no_mangle]
 pub extern "C" fn dataframe_to_csv(handle: usize) -> *mut c_char {
@@ -652,10 +995,10 @@ pub extern "C" fn dataframe_to_csv(handle: usize) -> *mut c_char {
         return ptr::null_mut();
     }
 
-    let df = unsafe { &*(handle as *const DataFrame) };
+    let Some(df) = registered_dataframe(handle) else { return ptr::null_mut() };
 
     let mut cursor = std::io::Cursor::new(Vec::new());
-    let mut df_clone = df.clone();
+    let mut df_clone = unwrap_or_clone(df);
     match CsvWriter::new(&mut cursor).finish(&mut df_clone) {
         Ok(_) => {
             let csv_data = cursor.into_inner();
@@ -675,7 +1018,7 @@ pub extern "C" fn dataframe_to_string(handle: usize) -> *mut c_char {
         return ptr::null_mut();
     }
 
-    let df = unsafe { &*(handle as *const DataFrame) };
+    let Some(df) = registered_dataframe(handle) else { return ptr::null_mut() };
     let df_string = format!("{}", df);
 
     match CString::new(df_string) {
@@ -684,6 +1027,45 @@ pub extern "C" fn dataframe_to_string(handle: usize) -> *mut c_char {
     }
 }
 
+/// Render the logical plan of a handle, before or after optimization
+/// Works for LazyFrame, LazyGroupBy (the group-by without aggregations) and
+/// DataFrame handles. Optional CollectArgs apply the same optimizer toggles as
+/// Collect. On success *out receives the plan, otherwise the error message;
+/// both are freed with free_string.
+#[no_mangle]
+pub extern "C" fn explain_plan(
+    handle: usize,
+    optimized: bool,
+    args: *const CollectArgs,
+    out: *mut *mut c_char,
+) -> c_int {
+    if out.is_null() {
+        return ERROR_NULL_ARGS;
+    }
+
+    let write = |code: c_int, text: String| {
+        let text = CString::new(text).unwrap_or_default();
+        unsafe { *out = text.into_raw() };
+        code
+    };
+
+    let lazy_frame = match crate::registry::get(handle) {
+        Some(Frame::DataFrame(df)) => unwrap_or_clone(df).lazy(),
+        Some(Frame::LazyFrame(lf)) => unwrap_or_clone(lf),
+        Some(Frame::LazyGroupBy(gb)) => unwrap_or_clone(gb).agg(Vec::<Expr>::new()),
+        None => return write(ERROR_NULL_HANDLE, "Invalid or released handle".to_string()),
+    };
+    let lazy_frame = match unsafe { args.as_ref() } {
+        Some(args) => with_optimizations(lazy_frame, args),
+        None => lazy_frame,
+    };
+
+    match lazy_frame.explain(optimized) {
+        Ok(plan) => write(0, plan),
+        Err(e) => write(ERROR_POLARS_OPERATION, e.to_string()),
+    }
+}
+
 /// Get DataFrame height (number of rows)
 #[no_mangle]
 pub extern "C" fn dataframe_height(handle: usize) -> usize {
@@ -691,19 +1073,19 @@ pub extern "C" fn dataframe_height(handle: usize) -> usize {
         return 0;
     }
 
-    let df = unsafe { &*(handle as *const DataFrame) };
-    df.height()
+    registered_dataframe(handle).map_or(0, |df| df.height())
 }
 
-/// Release DataFrame memory
+/// Release a handle of any context type (DataFrame, LazyFrame or LazyGroupBy)
+/// Drops one reference; the frame is freed by its real type when the last one goes.
+/// Returns ERROR_NULL_HANDLE for unknown or already released handles.
 #[no_mangle]
 pub extern "C" fn release_dataframe(handle: usize) -> c_int {
-    if handle != 0 {
-        unsafe {
-            let _ = Box::from_raw(handle as *mut DataFrame);
-        }
+    if handle == 0 || release(handle) {
+        0 // Return success
+    } else {
+        ERROR_NULL_HANDLE
     }
-    0 // Return success
 }
 
 /// Free C string memory
@@ -722,14 +1104,20 @@ pub extern "C" fn noop() -> c_int {
     0
 }
 
-/// Testing helper - adds a null row to DataFrame
 /// Collect operation - materializes LazyFrames into DataFrames
 /// If already a DataFrame, returns it as-is
-pub fn dispatch_collect(handle: PolarsHandle) -> FfiResult {
+/// Optional CollectArgs select the streaming engine and its memory budget
+pub fn dispatch_collect(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
     if handle.handle == 0 {
         return FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null");
     }
 
+    let args = if context.operation_args != 0 {
+        Some(unsafe { &*(context.operation_args as *const CollectArgs) })
+    } else {
+        None
+    };
+
     // Get context type and perform operation based on current context
     let context_type = match handle.get_context_type() {
         Some(ct) => ct,
@@ -739,15 +1127,15 @@ pub fn dispatch_collect(handle: PolarsHandle) -> FfiResult {
     match context_type {
         ContextType::DataFrame => {
             // Already materialized - return as-is
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
-            FfiResult::success(df.clone())
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
+            FfiResult::success_frame(Frame::DataFrame(df))
         }
         ContextType::LazyFrame => {
             // Materialize LazyFrame into DataFrame
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
-            match lazy_frame.clone().collect() {
-                Ok(df) => FfiResult::success(df),
-                Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
+            match collect_cached(unwrap_or_clone(lazy_frame), |lf| collect_lazy(lf, args)) {
+                Ok(df) => FfiResult::success_frame(Frame::DataFrame(df)),
+                Err(error) => error,
             }
         }
         ContextType::LazyGroupBy => {
@@ -763,6 +1151,7 @@ pub fn dispatch_collect(handle: PolarsHandle) -> FfiResult {
     }
 }
 
+/// Testing helper - adds a null row to DataFrame
 pub fn dispatch_add_null_row(handle: PolarsHandle) -> FfiResult {
     if handle.handle == 0 {
         return FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null");
@@ -776,7 +1165,7 @@ pub fn dispatch_add_null_row(handle: PolarsHandle) -> FfiResult {
 
     match context_type {
         ContextType::DataFrame => {
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
 
             // Create a single row with nulls for each column
             let null_series: Result<Vec<Series>, PolarsError> = df
@@ -801,7 +1190,7 @@ pub fn dispatch_add_null_row(handle: PolarsHandle) -> FfiResult {
             };
 
             // Concatenate the original DataFrame with the null row
-            match df.clone().vstack(&null_df) {
+            match unwrap_or_clone(df).vstack(&null_df) {
                 Ok(result_df) => FfiResult::success(result_df),
                 Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
             }
@@ -830,13 +1219,17 @@ pub fn dispatch_query(handle: PolarsHandle, ctx: &ExecutionContext) -> FfiResult
         Err(_) => return FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in SQL query"),
     };
 
+    if table_count() > 0 {
+        note_foreign_input(); // The query may read registered tables
+    }
+
     match handle.get_context_type() {
         Some(ContextType::DataFrame) => {
-            let df = unsafe { &*(handle.handle as *const DataFrame) };
+            let Some(df) = handle.dataframe() else { return FfiResult::invalid_handle() };
 
-            // Create SQL context and register the DataFrame as "df"
-            let mut sql_ctx = SQLContext::new();
-            sql_ctx.register("df", df.clone().lazy());
+            // Registered tables plus the DataFrame as "df"
+            let mut sql_ctx = sql_context();
+            sql_ctx.register("df", unwrap_or_clone(df).lazy());
 
             // Execute the SQL query
             match sql_ctx.execute(sql) {
@@ -848,11 +1241,11 @@ pub fn dispatch_query(handle: PolarsHandle, ctx: &ExecutionContext) -> FfiResult
             }
         }
         Some(ContextType::LazyFrame) => {
-            let lazy_frame = unsafe { &*(handle.handle as *const LazyFrame) };
+            let Some(lazy_frame) = handle.lazy_frame() else { return FfiResult::invalid_handle() };
 
-            // Create SQL context and register the LazyFrame as "df"
-            let mut sql_ctx = SQLContext::new();
-            sql_ctx.register("df", lazy_frame.clone());
+            // Registered tables plus the LazyFrame as "df"
+            let mut sql_ctx = sql_context();
+            sql_ctx.register("df", unwrap_or_clone(lazy_frame));
 
             // Execute the SQL query
             match sql_ctx.execute(sql) {
@@ -1,3 +1,9 @@
+use crate::cache::{note_op, SourceGuard};
+use crate::expr::SlotGuard;
+use crate::interrupt::{check_interrupt, InterruptGuard};
+use crate::profile;
+use crate::registry;
+use crate::runtime::{admit, LimitGuard};
 use crate::{ContextType, FfiResult, OpCode, Operation, PolarsHandle, ERROR_POLARS_OPERATION};
 use polars::prelude::*;
 
@@ -95,6 +101,19 @@ fn dispatch_expression_operation(opcode: OpCode, ctx: &ExecutionContext) -> FfiR
         OpCode::ExprOtherwise => expr_otherwise(ctx),
         // Cast operations
         OpCode::ExprCast => expr_cast(ctx),
+        // Prepared plan parameters
+        OpCode::ExprParam => expr_param(ctx),
+        // Common subexpression references
+        OpCode::ExprDup => expr_dup(ctx),
+        OpCode::ExprLoad => expr_load(ctx),
+        // Rolling, cumulative and exponentially weighted kernels
+        OpCode::ExprRollingSum
+        | OpCode::ExprRollingMean
+        | OpCode::ExprRollingMin
+        | OpCode::ExprRollingMax
+        | OpCode::ExprRollingStd => expr_rolling(opcode, ctx),
+        OpCode::ExprCumSum | OpCode::ExprCumMin | OpCode::ExprCumMax => expr_cum(opcode, ctx),
+        OpCode::ExprEwmMean | OpCode::ExprEwmStd => expr_ewm(opcode, ctx),
         _ => FfiResult::error(ERROR_POLARS_OPERATION, "Unsupported expression operation"),
     }
 }
@@ -105,6 +124,7 @@ fn dispatch_dataframe_operation(
     handle: PolarsHandle,
     context: &ExecutionContext,
 ) -> (FfiResult, ContextType) {
+    use crate::arrow::*;
     use crate::dataframe::*;
     use crate::io::*;
 
@@ -112,13 +132,14 @@ fn dispatch_dataframe_operation(
         OpCode::NewEmpty => (dispatch_new_empty(), ContextType::DataFrame),
         OpCode::ReadCsv => (dispatch_read_csv(handle, context), ContextType::LazyFrame),
         OpCode::ReadParquet => (dispatch_read_parquet(handle, context), ContextType::LazyFrame),
+        OpCode::ImportArrow => (dispatch_import_arrow(handle, context), ContextType::DataFrame),
         OpCode::Select => (dispatch_select(handle, context), ContextType::LazyFrame),
         OpCode::SelectExpr => (
             dispatch_select_expr(handle, context),
             ContextType::LazyFrame,
         ),
         OpCode::Count => (dispatch_count(handle), ContextType::LazyFrame),
-        OpCode::Concat => (dispatch_concat(handle, context), ContextType::DataFrame),
+        OpCode::Concat => (dispatch_concat(handle, context), ContextType::LazyFrame),
         OpCode::WithColumn => (
             dispatch_with_column(handle, context),
             ContextType::LazyFrame,
@@ -128,6 +149,11 @@ fn dispatch_dataframe_operation(
             ContextType::LazyFrame,
         ),
         OpCode::GroupBy => (dispatch_group_by(handle, context), ContextType::LazyGroupBy),
+        OpCode::GroupByDynamic => (
+            dispatch_group_by_dynamic(handle, context),
+            ContextType::LazyGroupBy,
+        ),
+        OpCode::Rolling => (dispatch_rolling(handle, context), ContextType::LazyGroupBy),
         OpCode::Agg => (dispatch_agg(handle, context), ContextType::LazyFrame),
         OpCode::Sort => {
             // Sort preserves the input context type (DataFrame->DataFrame, LazyFrame->LazyFrame)
@@ -140,13 +166,17 @@ fn dispatch_dataframe_operation(
             (dispatch_limit(handle, context), input_context)
         }
         OpCode::AddNullRow => (dispatch_add_null_row(handle), ContextType::DataFrame),
-        OpCode::Collect => (dispatch_collect(handle), ContextType::DataFrame),
+        OpCode::Collect => (dispatch_collect(handle, context), ContextType::DataFrame),
         OpCode::Query => (dispatch_query(handle, context), ContextType::LazyFrame),
         OpCode::Join => {
             // Join preserves the input context type (DataFrame->DataFrame, LazyFrame->LazyFrame)
             let input_context = handle.get_context_type().unwrap_or(ContextType::DataFrame);
             (dispatch_join(handle, context), input_context)
         }
+        // Sinks are terminal: the pipeline is written out and no handle is produced
+        OpCode::SinkParquet => (dispatch_sink_parquet(handle, context), ContextType::DataFrame),
+        OpCode::SinkCsv => (dispatch_sink_csv(handle, context), ContextType::DataFrame),
+        OpCode::SinkIpc => (dispatch_sink_ipc(handle, context), ContextType::DataFrame),
         _ => (
             FfiResult::error(ERROR_POLARS_OPERATION, "Unsupported DataFrame operation"),
             handle.get_context_type().unwrap_or(ContextType::DataFrame),
@@ -165,31 +195,62 @@ pub extern "C" fn execute_operations(
         return FfiResult::error(ERROR_POLARS_OPERATION, "Operations cannot be null or empty");
     }
 
+    // Wait for a free slot when a concurrency limit applies
+    let _admission = match admit() {
+        Ok(admission) => admission,
+        Err(stopped) => return stopped,
+    };
+
     let operations = unsafe { std::slice::from_raw_parts(operations_ptr, count) };
     let mut current_handle = polars_handle.handle;
     let mut current_context_type = polars_handle
         .get_context_type()
         .unwrap_or(ContextType::DataFrame); // Use the actual context from the handle
     let mut expr_stack = Vec::new(); // Expression stack for building expressions
+    let _sources = SourceGuard::begin(polars_handle.handle == 0); // Result cache fingerprinting
+    let _slots = SlotGuard::begin(); // ExprDup slots are scoped to this op stream
 
     for (frame_idx, op) in operations.iter().enumerate() {
+        // Stop between ops once cancelled or past the deadline (no-op without options)
+        if let Some(stopped) = check_interrupt() {
+            if current_handle != polars_handle.handle {
+                registry::release(current_handle);
+            }
+            return FfiResult {
+                error_frame: frame_idx,
+                ..stopped
+            };
+        }
 
         let opcode = match op.get_opcode() {
             Some(opcode) => opcode,
             None => {
-                return FfiResult::error(
-                    ERROR_POLARS_OPERATION,
-                    &format!("Invalid opcode: {}", op.opcode),
-                )
+                if current_handle != polars_handle.handle {
+                    registry::release(current_handle);
+                }
+                return FfiResult {
+                    error_frame: frame_idx,
+                    ..FfiResult::error(
+                        ERROR_POLARS_OPERATION,
+                        &format!("Invalid opcode: {}", op.opcode),
+                    )
+                };
             }
         };
 
+        note_op(op); // Part of the result cache key while the chain is cacheable
+
         // Create ExecutionContext for this operation
         let ctx = ExecutionContext {
             expr_stack: &mut expr_stack as *mut Vec<Expr>,
             operation_args: op.args,
         };
 
+        let timing = profile::frame_start(PolarsHandle::new(current_handle, current_context_type));
+        // Intermediates are unreachable from Go, so the op may consume their frame
+        let _consume = (current_handle != polars_handle.handle)
+            .then(|| registry::ConsumeGuard::mark(current_handle));
+
         // Dispatch based on operation type
         let (result, new_context_type) = if opcode.is_dataframe_op() {
             dispatch_dataframe_operation(
@@ -210,7 +271,15 @@ pub extern "C" fn execute_operations(
             )
         };
 
+        let output = (result.error_code == 0 && opcode.is_dataframe_op())
+            .then(|| PolarsHandle::new(result.polars_handle.handle, new_context_type));
+        profile::frame_end(timing, op.opcode, output);
+
         if result.error_code != 0 {
+            // Intermediates produced by this chain are unreachable from Go - free them
+            if current_handle != polars_handle.handle {
+                registry::release(current_handle);
+            }
             // Return error with frame information
             return FfiResult {
                 polars_handle: PolarsHandle::new(0, ContextType::DataFrame), // Error case
@@ -222,10 +291,58 @@ pub extern "C" fn execute_operations(
 
         // Only update handle for DataFrame operations, not expression operations
         if opcode.is_dataframe_op() {
-            current_handle = result.polars_handle.handle;
+            let new_handle = result.polars_handle.handle;
+            // Each op registers a fresh handle; the previous intermediate is only
+            // referenced by this loop, so release it (never the caller's input handle)
+            if new_handle != current_handle && current_handle != polars_handle.handle {
+                registry::release(current_handle);
+            }
+            current_handle = new_handle;
         }
         current_context_type = new_context_type;
     }
 
     FfiResult::success_with_handle(current_handle, current_context_type)
 }
+
+/// Execution options passed next to the op array
+/// All fields are optional; zeroed options behave like execute_operations.
+#[repr(C)]
+pub struct ExecutionOptions {
+    pub cancelled: *const i32, // Cancellation flag owned by the caller, set non-zero to stop (null for none)
+    pub timeout_ms: u64,       // Deadline relative to the start of the call (0 for none)
+    pub profile: *mut usize,   // Receives a profile handle when non-null (release with release_profile)
+    pub max_concurrent: usize, // Wait until fewer calls are running (0 = default set by firn_init)
+}
+
+/// Execute an operation chain with cancellation, a deadline and optional profiling
+/// The stop conditions are checked between ops and while collecting, so a long
+/// collect aborts early. Returns ERROR_CANCELLED or ERROR_DEADLINE_EXCEEDED when
+/// interrupted, including while waiting for the concurrency limit; a null options
+/// pointer behaves like execute_operations.
+#[no_mangle]
+pub extern "C" fn execute_operations_with_options(
+    polars_handle: PolarsHandle,
+    operations_ptr: *const Operation,
+    count: usize,
+    options: *const ExecutionOptions,
+) -> FfiResult {
+    if options.is_null() {
+        return execute_operations(polars_handle, operations_ptr, count);
+    }
+
+    let options = unsafe { &*options };
+    let _guard = InterruptGuard::install(options);
+    let _limit = LimitGuard::install(options.max_concurrent);
+    if options.profile.is_null() {
+        return execute_operations(polars_handle, operations_ptr, count);
+    }
+
+    profile::start_profile();
+    let result = execute_operations(polars_handle, operations_ptr, count);
+    if let Some(profile) = profile::finish_profile() {
+        // Written even on error, so the frames up to the failure can be inspected
+        unsafe { *options.profile = Box::into_raw(Box::new(profile)) as usize };
+    }
+    result
+}
@@ -1,6 +1,7 @@
-use crate::{ExecutionContext, FfiResult, ERROR_INVALID_UTF8, ERROR_POLARS_OPERATION};
-use crate::types::{decode_data_type, CastArgs, ColumnArgs, LiteralArgs, AliasArgs, StringArgs, AggregationArgs, CountArgs};
+use crate::{ExecutionContext, FfiResult, OpCode, ERROR_INVALID_UTF8, ERROR_POLARS_OPERATION};
+use crate::types::{decode_data_type, decode_enum_type, ENUM_DATA_TYPE, CastArgs, ColumnArgs, LiteralArgs, AliasArgs, StringArgs, AggregationArgs, CountArgs, ParamArgs, SlotArgs};
 use polars::prelude::*;
+use std::cell::RefCell;
 
 /// Helper function for binary expression operations
 /// Takes a closure that operates on (left, right) expressions and returns the result
@@ -38,8 +39,13 @@ pub fn expr_cast(ctx: &ExecutionContext) -> FfiResult {
         );
     }
 
-    // Decode the bit-packed data type
-    let dtype = match decode_data_type(args.dtype) {
+    // Decode the bit-packed data type (Enum categories travel next to it)
+    let dtype = if args.dtype == ENUM_DATA_TYPE {
+        unsafe { decode_enum_type(args.categories, args.category_count) }
+    } else {
+        decode_data_type(args.dtype)
+    };
+    let dtype = match dtype {
         Ok(dt) => dt,
         Err(err) => return err,
     };
@@ -101,6 +107,78 @@ pub fn expr_literal(ctx: &ExecutionContext) -> FfiResult {
     FfiResult::success_no_handle()
 }
 
+/// Parameter placeholder - pushes a slot that execute_prepared later binds to a literal
+pub fn expr_param(ctx: &ExecutionContext) -> FfiResult {
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+    let args = unsafe { &*(ctx.operation_args as *const ParamArgs) };
+
+    expr_stack.push(crate::plan::param_placeholder(args.index));
+    FfiResult::success_no_handle()
+}
+
+// Common subexpression references
+
+thread_local! {
+    /// Expressions saved by ExprDup in the op stream running on this thread
+    static SLOTS: RefCell<Vec<Option<Expr>>> = const { RefCell::new(Vec::new()) };
+}
+
+/// Scopes subexpression slots to one op stream, restoring the outer stream's on drop
+pub(crate) struct SlotGuard {
+    previous: Vec<Option<Expr>>,
+}
+
+impl SlotGuard {
+    pub(crate) fn begin() -> Self {
+        SlotGuard {
+            previous: SLOTS.with(|slots| slots.take()),
+        }
+    }
+}
+
+impl Drop for SlotGuard {
+    fn drop(&mut self) {
+        let previous = std::mem::take(&mut self.previous);
+        SLOTS.with(|slots| *slots.borrow_mut() = previous);
+    }
+}
+
+/// Dup - saves a copy of the top expression into a slot for later ExprLoads
+pub fn expr_dup(ctx: &ExecutionContext) -> FfiResult {
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+    let args = unsafe { &*(ctx.operation_args as *const SlotArgs) };
+
+    let Some(expr) = expr_stack.last() else {
+        return FfiResult::error(ERROR_POLARS_OPERATION, "dup requires 1 expression on stack");
+    };
+    let slot = args.slot as usize;
+    SLOTS.with(|slots| {
+        let mut slots = slots.borrow_mut();
+        if slots.len() <= slot {
+            slots.resize(slot + 1, None);
+        }
+        slots[slot] = Some(expr.clone());
+    });
+    FfiResult::success_no_handle()
+}
+
+/// Load - pushes a copy of an expression saved by ExprDup
+pub fn expr_load(ctx: &ExecutionContext) -> FfiResult {
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+    let args = unsafe { &*(ctx.operation_args as *const SlotArgs) };
+
+    match SLOTS.with(|slots| slots.borrow().get(args.slot as usize).cloned().flatten()) {
+        Some(expr) => {
+            expr_stack.push(expr);
+            FfiResult::success_no_handle()
+        }
+        None => FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            &format!("load of unset subexpression slot {}", args.slot),
+        ),
+    }
+}
+
 // Comparison operations
 pub fn expr_gt(ctx: &ExecutionContext) -> FfiResult {
     binary_expr_op(ctx, "greater than", |left, right| left.gt(right))
@@ -497,6 +575,131 @@ pub fn expr_lead(ctx: &ExecutionContext) -> FfiResult {
     FfiResult::success_no_handle()
 }
 
+/// Rolling aggregation over a fixed number of rows or a duration
+/// With a `by` column the window is the duration ending at each row of that sorted
+/// temporal column; otherwise it is the last window_size rows.
+pub fn expr_rolling(opcode: OpCode, ctx: &ExecutionContext) -> FfiResult {
+    use crate::dataframe::{closed_window, window_duration};
+    use crate::RollingExprArgs;
+
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+    let args = unsafe { &*(ctx.operation_args as *const RollingExprArgs) };
+
+    if expr_stack.is_empty() {
+        return FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            "rolling aggregation requires 1 expression on stack",
+        );
+    }
+
+    let fn_params = (opcode == OpCode::ExprRollingStd)
+        .then(|| RollingFnParams::Var(RollingVarParams { ddof: args.ddof }));
+    let by = match unsafe { args.by.as_str() } {
+        Ok(by) => by,
+        Err(_) => {
+            return FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in rolling by column")
+        }
+    };
+
+    let expr = expr_stack.pop().unwrap();
+    let rolled = if by.is_empty() {
+        if args.window_size == 0 {
+            return FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                "Rolling window size must be positive",
+            );
+        }
+        let options = RollingOptionsFixedWindow {
+            window_size: args.window_size,
+            min_periods: match args.min_periods {
+                0 => args.window_size,
+                min_periods => min_periods,
+            },
+            center: args.center,
+            fn_params,
+            ..Default::default()
+        };
+        match opcode {
+            OpCode::ExprRollingSum => expr.rolling_sum(options),
+            OpCode::ExprRollingMean => expr.rolling_mean(options),
+            OpCode::ExprRollingMin => expr.rolling_min(options),
+            OpCode::ExprRollingMax => expr.rolling_max(options),
+            _ => expr.rolling_std(options),
+        }
+    } else {
+        let window_size = match window_duration(&args.duration, "duration", None) {
+            Ok(duration) => duration,
+            Err(e) => return e,
+        };
+        let options = RollingOptionsDynamicWindow {
+            window_size,
+            min_periods: args.min_periods.max(1),
+            closed_window: closed_window(args.closed, ClosedWindow::Right),
+            fn_params,
+        };
+        let by = col(by);
+        match opcode {
+            OpCode::ExprRollingSum => expr.rolling_sum_by(by, options),
+            OpCode::ExprRollingMean => expr.rolling_mean_by(by, options),
+            OpCode::ExprRollingMin => expr.rolling_min_by(by, options),
+            OpCode::ExprRollingMax => expr.rolling_max_by(by, options),
+            _ => expr.rolling_std_by(by, options),
+        }
+    };
+
+    expr_stack.push(rolled);
+    FfiResult::success_no_handle()
+}
+
+/// Cumulative sum, min or max from the first row
+pub fn expr_cum(opcode: OpCode, ctx: &ExecutionContext) -> FfiResult {
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+
+    if expr_stack.is_empty() {
+        return FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            "cumulative aggregation requires 1 expression on stack",
+        );
+    }
+
+    let expr = expr_stack.pop().unwrap();
+    expr_stack.push(match opcode {
+        OpCode::ExprCumSum => expr.cum_sum(false),
+        OpCode::ExprCumMin => expr.cum_min(false),
+        _ => expr.cum_max(false),
+    });
+    FfiResult::success_no_handle()
+}
+
+/// Exponentially weighted moving mean or standard deviation
+pub fn expr_ewm(opcode: OpCode, ctx: &ExecutionContext) -> FfiResult {
+    use crate::EwmArgs;
+
+    let expr_stack = unsafe { &mut *ctx.expr_stack };
+    let args = unsafe { &*(ctx.operation_args as *const EwmArgs) };
+
+    if expr_stack.is_empty() {
+        return FfiResult::error(ERROR_POLARS_OPERATION, "ewm requires 1 expression on stack");
+    }
+    if !(args.alpha > 0.0 && args.alpha <= 1.0) {
+        return FfiResult::error(ERROR_POLARS_OPERATION, "EWM alpha must be in (0, 1]");
+    }
+
+    let options = EWMOptions {
+        alpha: args.alpha,
+        adjust: args.adjust,
+        bias: args.bias,
+        min_periods: args.min_periods,
+        ignore_nulls: args.ignore_nulls,
+    };
+    let expr = expr_stack.pop().unwrap();
+    expr_stack.push(match opcode {
+        OpCode::ExprEwmMean => expr.ewm_mean(options),
+        _ => expr.ewm_std(options),
+    });
+    FfiResult::success_no_handle()
+}
+
 // Conditional expression operations
 
 /// When operation - starts a conditional chain
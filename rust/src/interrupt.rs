@@ -0,0 +1,102 @@
+use crate::execution::ExecutionOptions;
+use crate::profile::collect_profiled;
+use crate::{FfiResult, ERROR_CANCELLED, ERROR_DEADLINE_EXCEEDED, ERROR_POLARS_OPERATION};
+use polars::prelude::{DataFrame, LazyFrame, PolarsError};
+use std::cell::Cell;
+use std::sync::atomic::{AtomicI32, Ordering};
+use std::time::{Duration, Instant};
+
+/// How often a cancellable collect polls its stop conditions
+const POLL_INTERVAL: Duration = Duration::from_millis(1);
+
+/// Stop conditions of the execute call running on this thread
+#[derive(Clone, Copy)]
+struct Interrupt {
+    cancelled: *const AtomicI32,
+    deadline: Option<Instant>,
+}
+
+thread_local! {
+    static CURRENT: Cell<Option<Interrupt>> = const { Cell::new(None) };
+}
+
+/// Installs the stop conditions for the duration of one execute call
+pub(crate) struct InterruptGuard {
+    previous: Option<Interrupt>,
+}
+
+impl InterruptGuard {
+    /// With neither a flag nor a timeout the call stays uninterruptible
+    pub(crate) fn install(options: &ExecutionOptions) -> Self {
+        let interrupt =
+            (!options.cancelled.is_null() || options.timeout_ms > 0).then(|| Interrupt {
+                cancelled: options.cancelled as *const AtomicI32,
+                deadline: (options.timeout_ms > 0)
+                    .then(|| Instant::now() + Duration::from_millis(options.timeout_ms)),
+            });
+        InterruptGuard {
+            previous: CURRENT.with(|current| current.replace(interrupt)),
+        }
+    }
+}
+
+impl Drop for InterruptGuard {
+    fn drop(&mut self) {
+        CURRENT.with(|current| current.set(self.previous));
+    }
+}
+
+impl Interrupt {
+    fn check(&self) -> Option<FfiResult> {
+        if !self.cancelled.is_null() && unsafe { (*self.cancelled).load(Ordering::Relaxed) } != 0 {
+            return Some(FfiResult::error(ERROR_CANCELLED, "Query cancelled"));
+        }
+        if self
+            .deadline
+            .is_some_and(|deadline| Instant::now() >= deadline)
+        {
+            return Some(FfiResult::error(
+                ERROR_DEADLINE_EXCEEDED,
+                "Query deadline exceeded",
+            ));
+        }
+        None
+    }
+}
+
+/// Check the current call's stop conditions - called between ops
+pub(crate) fn check_interrupt() -> Option<FfiResult> {
+    CURRENT
+        .with(|current| current.get())
+        .and_then(|interrupt| interrupt.check())
+}
+
+/// Collect a LazyFrame, stopping early if the current call is cancelled or times out
+/// Without stop conditions this is a plain (or profiled) collect. Otherwise the query runs on the
+/// Polars thread pool while this thread polls; on interrupt the Polars stop flag is
+/// raised, and the query aborts at the next physical operator.
+pub(crate) fn collect_interruptible(lazy_frame: LazyFrame) -> Result<DataFrame, FfiResult> {
+    let Some(interrupt) = CURRENT.with(|current| current.get()) else {
+        return collect_profiled(lazy_frame).map_err(polars_error);
+    };
+    if let Some(stopped) = interrupt.check() {
+        return Err(stopped);
+    }
+
+    let query = lazy_frame.collect_concurrently().map_err(polars_error)?;
+    loop {
+        if let Some(result) = query.fetch() {
+            return result.map_err(polars_error);
+        }
+        if let Some(stopped) = interrupt.check() {
+            query.cancel();
+            let _ = query.fetch_blocking(); // Wait for the workers before dropping the query
+            return Err(stopped);
+        }
+        std::thread::sleep(POLL_INTERVAL);
+    }
+}
+
+fn polars_error(e: PolarsError) -> FfiResult {
+    FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string())
+}
@@ -1,8 +1,18 @@
 use crate::{
-    ExecutionContext, FfiResult, PolarsHandle, RawStr, 
-    ERROR_INVALID_UTF8, ERROR_POLARS_OPERATION,
+    decode_schema, ContextType, ExecutionContext, FfiResult, PolarsHandle, RawStr, SchemaField,
+    ERROR_INVALID_UTF8, ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
 };
-use polars::prelude::{LazyFrame, LazyCsvReader, ScanArgsParquet, LazyFileListReader};
+use polars::io::parquet::write::{
+    BrotliLevel, GzipLevel, ParquetCompression, ParquetWriteOptions, StatisticsOptions, ZstdLevel,
+};
+use polars::prelude::{
+    CsvWriterOptions, DataFrame, IntoLazy, IpcCompression, IpcWriterOptions, LazyCsvReader,
+    IdxSize, LazyFileListReader, LazyFrame, PolarsError, PolarsResult, RowIndex, ScanArgsParquet,
+};
+use crate::cache::note_source;
+use crate::registry::unwrap_or_clone;
+use std::num::NonZeroUsize;
+use std::sync::Arc;
 
 /// Helper function to convert RawStr array to Vec<String>
 unsafe fn raw_str_array_to_vec(
@@ -32,9 +42,24 @@ pub struct ReadCsvArgs {
     pub path: RawStr,     // File path using zero-copy RawStr
     pub has_header: bool, // Whether CSV has header row
     pub with_glob: bool,  // Whether to expand glob patterns
+    pub schema: *const SchemaField,          // Full schema - disables inference (null for none)
+    pub schema_count: usize,                 // Number of schema fields
+    pub dtype_overrides: *const SchemaField, // Dtypes overriding inference for some columns
+    pub dtype_override_count: usize,         // Number of overrides
+    pub infer_schema_length: i64,            // Rows used for inference (0 = default, -1 = all)
+    pub separator: u8,                       // Field separator (0 = ',')
+    pub quote_char: u8,                      // Quote character (0 = '"')
+    pub disable_quoting: bool,               // Treat quote characters as data
+    pub n_rows: usize,                       // Stop after this many rows (0 = all)
+    pub skip_rows: usize,                    // Lines to skip before the header/data
+    pub low_memory: bool,                    // Reduce memory pressure at the expense of speed
+    pub rechunk: bool,                       // Rechunk into contiguous memory after reading
+    pub chunk_size: usize,                   // Rows per parallel parsing chunk (0 = default)
 }
 
 /// Arguments for reading Parquet files
+/// All options are applied together on the scan; column selection is a projection
+/// that the optimizer pushes into the reader, so unselected columns are never decoded.
 #[repr(C)]
 pub struct ReadParquetArgs {
     pub path: RawStr,               // File path using zero-copy RawStr
@@ -43,6 +68,14 @@ pub struct ReadParquetArgs {
     pub n_rows: usize,              // Number of rows to read (0 for all)
     pub parallel: bool,             // Whether to read in parallel
     pub with_glob: bool,            // Whether to expand glob patterns
+    pub use_statistics: bool,       // Prune row groups using min/max statistics
+    pub hive_partitioning: u32,     // HivePartitioning: 0 = auto, 1 = disabled, 2 = enabled
+    pub try_parse_hive_dates: bool, // Parse date/datetime hive partition values
+    pub low_memory: bool,           // Reduce memory pressure at the expense of speed
+    pub cache: bool,                // Cache the scan result when it is used more than once
+    pub rechunk: bool,              // Rechunk into contiguous memory after reading
+    pub row_index_name: RawStr,     // Name of a row index column to add (empty for none)
+    pub row_index_offset: u32,      // Starting value of the row index
 }
 
 /// Dispatch function for reading CSV
@@ -54,12 +87,57 @@ pub fn dispatch_read_csv(_handle: PolarsHandle, context: &ExecutionContext) -> F
         Ok(s) => s,
         Err(_) => return FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in path"),
     };
+    note_source(path_str); // Fingerprinted by the result cache
+
+    let schema = if args.schema_count > 0 {
+        match unsafe { decode_schema(args.schema, args.schema_count) } {
+            Ok(schema) => Some(Arc::new(schema)),
+            Err(result) => return result,
+        }
+    } else {
+        None
+    };
+    let dtype_overrides = if args.dtype_override_count > 0 {
+        match unsafe { decode_schema(args.dtype_overrides, args.dtype_override_count) } {
+            Ok(schema) => Some(Arc::new(schema)),
+            Err(result) => return result,
+        }
+    } else {
+        None
+    };
+
+    let infer_schema_length = match args.infer_schema_length {
+        0 => Some(100), // Polars default
+        n if n < 0 => None, // Scan the whole file
+        n => Some(n as usize),
+    };
+
+    let quote_char = if args.disable_quoting {
+        None
+    } else if args.quote_char != 0 {
+        Some(args.quote_char)
+    } else {
+        Some(b'"')
+    };
 
     // Use LazyCsvReader with configurable options - return LazyFrame for lazy evaluation
-    match LazyCsvReader::new(path_str)
+    let mut reader = LazyCsvReader::new(path_str)
         .with_has_header(args.has_header) // Configurable header detection
-        .finish()
-    {
+        .with_glob(args.with_glob)
+        .with_schema(schema)
+        .with_dtype_overwrite(dtype_overrides)
+        .with_infer_schema_length(infer_schema_length)
+        .with_separator(if args.separator != 0 { args.separator } else { b',' })
+        .with_quote_char(quote_char)
+        .with_n_rows((args.n_rows > 0).then_some(args.n_rows))
+        .with_skip_rows(args.skip_rows)
+        .with_low_memory(args.low_memory)
+        .with_rechunk(args.rechunk);
+    if args.chunk_size > 0 {
+        reader = reader.with_chunk_size(args.chunk_size);
+    }
+
+    match reader.finish() {
         Ok(lazy_frame) => FfiResult::success_lazy(lazy_frame),
         Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
     }
@@ -74,45 +152,263 @@ pub fn dispatch_read_parquet(_handle: PolarsHandle, context: &ExecutionContext)
         Ok(s) => s,
         Err(_) => return FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in path"),
     };
+    note_source(path_str); // Fingerprinted by the result cache
+
+    let mut scan_args = ScanArgsParquet {
+        n_rows: (args.n_rows > 0).then_some(args.n_rows),
+        parallel: if args.parallel {
+            polars::prelude::ParallelStrategy::Auto
+        } else {
+            polars::prelude::ParallelStrategy::None
+        },
+        use_statistics: args.use_statistics,
+        low_memory: args.low_memory,
+        cache: args.cache,
+        rechunk: args.rechunk,
+        glob: args.with_glob,
+        ..ScanArgsParquet::default()
+    };
+
+    scan_args.hive_options.enabled = match args.hive_partitioning {
+        1 => Some(false),
+        2 => Some(true),
+        _ => None, // Auto: enabled when scanning a directory
+    };
+    scan_args.hive_options.try_parse_dates = args.try_parse_hive_dates;
+
+    let row_index_name = match unsafe { args.row_index_name.as_str() } {
+        Ok(s) => s,
+        Err(_) => return FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in row index name"),
+    };
+    if !row_index_name.is_empty() {
+        scan_args.row_index = Some(RowIndex {
+            name: row_index_name.into(),
+            offset: args.row_index_offset as IdxSize,
+        });
+    }
 
-    // Build ScanArgsParquet properly instead of using Default and applying operations later
-    let mut scan_args = ScanArgsParquet::default();
+    let lazy_frame = match LazyFrame::scan_parquet(path_str, scan_args) {
+        Ok(lf) => lf,
+        Err(e) => return FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+    };
 
-    // Handle column selection if specified
+    // Column selection - projection pushdown moves this into the Parquet reader
     if !args.columns.is_null() && args.column_count > 0 {
         let columns = match unsafe { raw_str_array_to_vec(args.columns, args.column_count) } {
             Ok(cols) => cols,
             Err(msg) => return FfiResult::error(ERROR_POLARS_OPERATION, msg),
         };
-        // For now, we'll apply column selection after scan since projection field might not be available
-        // This is still better than the previous approach since we use n_rows properly
-        let lazy_frame = match LazyFrame::scan_parquet(path_str, scan_args) {
-            Ok(lf) => lf,
-            Err(e) => return FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
-        };
-        
-        // Apply column selection and return LazyFrame for lazy evaluation
-        let column_exprs: Vec<polars::prelude::Expr> = columns.iter().map(|s| polars::prelude::col(s)).collect();
-        let selected_lazy = lazy_frame.select(column_exprs);
-        
-        return FfiResult::success_lazy(selected_lazy);
+        let mut column_exprs: Vec<polars::prelude::Expr> = Vec::with_capacity(columns.len() + 1);
+        // Keep the requested row index even when it is not listed explicitly
+        if !row_index_name.is_empty() && !columns.iter().any(|c| c == row_index_name) {
+            column_exprs.push(polars::prelude::col(row_index_name));
+        }
+        column_exprs.extend(columns.iter().map(|s| polars::prelude::col(s)));
+        return FfiResult::success_lazy(lazy_frame.select(column_exprs));
     }
 
-    // Handle row limit if specified - this is the proper way to limit during scan
-    if args.n_rows > 0 {
-        scan_args.n_rows = Some(args.n_rows);
+    FfiResult::success_lazy(lazy_frame)
+}
+
+/// Compression codecs accepted by the sink operations
+/// IPC sinks support only Uncompressed, Lz4 and Zstd
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub enum SinkCompression {
+    Uncompressed = 0,
+    Snappy = 1,
+    Gzip = 2,
+    Lz4 = 3,
+    Zstd = 4,
+    Brotli = 5,
+}
+
+/// Arguments for streaming a LazyFrame into a Parquet file
+#[repr(C)]
+pub struct SinkParquetArgs {
+    pub path: RawStr,                 // Output file path
+    pub compression: SinkCompression, // Compression codec
+    pub compression_level: i32,       // Codec level (0 = codec default)
+    pub row_group_size: usize,        // Rows per row group (0 = Polars default)
+    pub data_page_size: usize,        // Bytes per data page (0 = Polars default)
+    pub statistics: bool,             // Write min/max/null-count column statistics
+    pub maintain_order: bool,         // Preserve row order (slower when false is acceptable)
+}
+
+/// Arguments for streaming a LazyFrame into a CSV file
+#[repr(C)]
+pub struct SinkCsvArgs {
+    pub path: RawStr,         // Output file path
+    pub include_header: bool, // Write a header row
+    pub separator: u8,        // Field separator (0 = ',')
+    pub batch_size: usize,    // Rows serialized per batch (0 = Polars default)
+    pub maintain_order: bool, // Preserve row order
+}
+
+/// Arguments for streaming a LazyFrame into an Arrow IPC file
+#[repr(C)]
+pub struct SinkIpcArgs {
+    pub path: RawStr,                 // Output file path
+    pub compression: SinkCompression, // Uncompressed, Lz4 or Zstd
+    pub maintain_order: bool,         // Preserve row order
+}
+
+/// Resolve the LazyFrame a sink writes from
+/// DataFrames are wrapped lazily (no copy); grouped data must be aggregated first
+fn sink_source(handle: PolarsHandle) -> std::result::Result<LazyFrame, FfiResult> {
+    if handle.handle == 0 {
+        return Err(FfiResult::error(ERROR_NULL_HANDLE, "Handle cannot be null"));
     }
 
-    // Handle parallel reading
-    scan_args.parallel = if args.parallel {
-        polars::prelude::ParallelStrategy::Auto
-    } else {
-        polars::prelude::ParallelStrategy::None
-    };
+    match handle.get_context_type() {
+        Some(ContextType::DataFrame) => {
+            let Some(df) = handle.dataframe() else { return Err(FfiResult::invalid_handle()) };
+            Ok(unwrap_or_clone(df).lazy())
+        }
+        Some(ContextType::LazyFrame) => {
+            let Some(lazy_frame) = handle.lazy_frame() else { return Err(FfiResult::invalid_handle()) };
+            Ok(unwrap_or_clone(lazy_frame))
+        }
+        Some(context_type) => Err(FfiResult::error(
+            ERROR_POLARS_OPERATION,
+            &format!(
+                "Cannot sink {}. Call agg() first to resolve grouping.",
+                context_type.name()
+            ),
+        )),
+        None => Err(FfiResult::error(ERROR_POLARS_OPERATION, "Invalid context type")),
+    }
+}
 
-    // Use LazyFrame scan_parquet with proper ScanArgsParquet - return LazyFrame for lazy evaluation
-    match LazyFrame::scan_parquet(path_str, scan_args) {
-        Ok(lazy_frame) => FfiResult::success_lazy(lazy_frame),
+/// Decode the output path of a sink
+fn sink_path(path: &RawStr) -> std::result::Result<&str, FfiResult> {
+    match unsafe { path.as_str() } {
+        Ok("") => Err(FfiResult::error(ERROR_NULL_ARGS, "Sink path cannot be empty")),
+        Ok(s) => Ok(s),
+        Err(_) => Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in path")),
+    }
+}
+
+fn parquet_compression(compression: SinkCompression, level: i32) -> PolarsResult<ParquetCompression> {
+    let level = (level > 0).then_some(level);
+    Ok(match compression {
+        SinkCompression::Uncompressed => ParquetCompression::Uncompressed,
+        SinkCompression::Snappy => ParquetCompression::Snappy,
+        SinkCompression::Lz4 => ParquetCompression::Lz4Raw,
+        SinkCompression::Gzip => {
+            ParquetCompression::Gzip(level.map(|l| GzipLevel::try_new(l as u8)).transpose()?)
+        }
+        SinkCompression::Zstd => ParquetCompression::Zstd(level.map(ZstdLevel::try_new).transpose()?),
+        SinkCompression::Brotli => {
+            ParquetCompression::Brotli(level.map(|l| BrotliLevel::try_new(l as u32)).transpose()?)
+        }
+    })
+}
+
+fn ipc_compression(compression: SinkCompression) -> PolarsResult<Option<IpcCompression>> {
+    match compression {
+        SinkCompression::Uncompressed => Ok(None),
+        SinkCompression::Lz4 => Ok(Some(IpcCompression::LZ4)),
+        SinkCompression::Zstd => Ok(Some(IpcCompression::ZSTD)),
+        other => Err(PolarsError::ComputeError(
+            format!("IPC sink does not support {:?} compression", other).into(),
+        )),
+    }
+}
+
+/// Convert a sink outcome into an FfiResult with no handle
+fn sink_result(result: PolarsResult<()>) -> FfiResult {
+    match result {
+        Ok(()) => FfiResult::success_no_handle(),
         Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
     }
 }
+
+/// Dispatch function for SinkParquet
+/// Runs the pipeline on the streaming engine and writes row groups as they are produced
+pub fn dispatch_sink_parquet(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "SinkParquetArgs cannot be null");
+    }
+    let args = unsafe { &*(context.operation_args as *const SinkParquetArgs) };
+
+    let path = match sink_path(&args.path) {
+        Ok(path) => path,
+        Err(result) => return result,
+    };
+    let lazy_frame = match sink_source(handle) {
+        Ok(lf) => lf,
+        Err(result) => return result,
+    };
+
+    sink_result(
+        parquet_compression(args.compression, args.compression_level).and_then(|compression| {
+            let options = ParquetWriteOptions {
+                compression,
+                statistics: if args.statistics {
+                    StatisticsOptions::default()
+                } else {
+                    StatisticsOptions::empty()
+                },
+                row_group_size: (args.row_group_size > 0).then_some(args.row_group_size),
+                data_page_size: (args.data_page_size > 0).then_some(args.data_page_size),
+                maintain_order: args.maintain_order,
+            };
+            lazy_frame.sink_parquet(path, options)
+        }),
+    )
+}
+
+/// Dispatch function for SinkCsv
+pub fn dispatch_sink_csv(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "SinkCsvArgs cannot be null");
+    }
+    let args = unsafe { &*(context.operation_args as *const SinkCsvArgs) };
+
+    let path = match sink_path(&args.path) {
+        Ok(path) => path,
+        Err(result) => return result,
+    };
+    let lazy_frame = match sink_source(handle) {
+        Ok(lf) => lf,
+        Err(result) => return result,
+    };
+
+    let mut options = CsvWriterOptions::default();
+    options.include_header = args.include_header;
+    options.maintain_order = args.maintain_order;
+    if args.separator != 0 {
+        options.serialize_options.separator = args.separator;
+    }
+    if let Some(batch_size) = NonZeroUsize::new(args.batch_size) {
+        options.batch_size = batch_size;
+    }
+
+    sink_result(lazy_frame.sink_csv(path, options))
+}
+
+/// Dispatch function for SinkIpc
+pub fn dispatch_sink_ipc(handle: PolarsHandle, context: &ExecutionContext) -> FfiResult {
+    if context.operation_args == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "SinkIpcArgs cannot be null");
+    }
+    let args = unsafe { &*(context.operation_args as *const SinkIpcArgs) };
+
+    let path = match sink_path(&args.path) {
+        Ok(path) => path,
+        Err(result) => return result,
+    };
+    let lazy_frame = match sink_source(handle) {
+        Ok(lf) => lf,
+        Err(result) => return result,
+    };
+
+    sink_result(ipc_compression(args.compression).and_then(|compression| {
+        let options = IpcWriterOptions {
+            compression,
+            maintain_order: args.maintain_order,
+        };
+        lazy_frame.sink_ipc(path, options)
+    }))
+}
@@ -2,28 +2,65 @@ use polars::prelude::{DataFrame, LazyFrame, LazyGroupBy};
 use std::ffi::CString;
 use std::os::raw::{c_char, c_int};
 use std::ptr;
+use std::sync::Arc;
 
 // Module declarations
+mod arrow;
+mod batch;
+mod cache;
+mod column;
+mod cursor;
 mod dataframe;
 mod execution;
 mod expr;
+mod interrupt;
 mod io;
+mod memory;
 mod opcodes;
+mod plan;
+mod profile;
+mod query;
+mod registry;
+mod runtime;
+mod schema;
+mod string_cache;
+mod tables;
 mod types;
+mod wire;
 
 // Re-export public items
+pub use arrow::*;
+pub use batch::*;
+pub use cache::{clear_result_cache, configure_result_cache, result_cache_stats, CacheStats};
+pub use column::{dataframe_column_info, dataframe_copy_column, ColumnInfo};
+pub use cursor::*;
 pub use dataframe::*;
-pub use execution::{execute_expr_ops, execute_operations, ExecutionContext};
+pub use execution::{
+    execute_expr_ops, execute_operations, execute_operations_with_options, ExecutionContext,
+    ExecutionOptions,
+};
 pub use expr::*;
 pub use io::*;
+pub use memory::{dataframe_estimated_size, memory_stats, reset_peak_memory, MemoryStats};
 pub use opcodes::*;
+pub use plan::*;
+pub use profile::*;
+pub use query::*;
+pub use registry::{live_handle_count, retain_handle, Frame};
+pub use runtime::{firn_init, FirnConfig};
+pub use schema::{dataframe_schema, release_schema, SchemaBuffer};
+pub use string_cache::{string_cache_acquire, string_cache_enabled, string_cache_release};
+pub use tables::{register_table, unregister_table};
 pub use types::*;
+pub use wire::execute_encoded;
 
 // Error codes
 pub const ERROR_NULL_HANDLE: c_int = 1;
 pub const ERROR_NULL_ARGS: c_int = 2;
 pub const ERROR_INVALID_UTF8: c_int = 3;
 pub const ERROR_POLARS_OPERATION: c_int = 4;
+pub const ERROR_CANCELLED: c_int = 5;
+pub const ERROR_DEADLINE_EXCEEDED: c_int = 6;
 
 /// Zero-copy string representation for FFI
 #[repr(C)]
@@ -61,40 +98,36 @@ pub struct FfiResult {
 impl FfiResult {
     /// Create a successful result with a new DataFrame
     pub fn success(df: DataFrame) -> Self {
-        let boxed_df = Box::new(df);
-        let handle = Box::into_raw(boxed_df) as usize;
-        Self {
-            polars_handle: PolarsHandle::new(handle, ContextType::DataFrame),
-            error_code: 0,
-            error_message: ptr::null_mut(),
-            error_frame: 0,
-        }
+        Self::success_frame(Frame::DataFrame(Arc::new(df)))
     }
 
     /// Create a successful result with a new LazyFrame
     pub fn success_lazy(lazy_frame: LazyFrame) -> Self {
-        let boxed_lazy = Box::new(lazy_frame);
-        let handle = Box::into_raw(boxed_lazy) as usize;
-        Self {
-            polars_handle: PolarsHandle::new(handle, ContextType::LazyFrame),
-            error_code: 0,
-            error_message: ptr::null_mut(),
-            error_frame: 0,
-        }
+        Self::success_frame(Frame::LazyFrame(Arc::new(lazy_frame)))
     }
 
     /// Create a successful result with a new LazyGroupBy
     pub fn success_lazy_group_by(lazy_group_by: LazyGroupBy) -> Self {
-        let boxed_lazy_group_by = Box::new(lazy_group_by);
-        let handle = Box::into_raw(boxed_lazy_group_by) as usize;
+        Self::success_frame(Frame::LazyGroupBy(Arc::new(lazy_group_by)))
+    }
+
+    /// Register a (possibly shared) frame under a new handle
+    pub fn success_frame(frame: Frame) -> Self {
+        let context_type = frame.context_type();
+        let handle = registry::insert(frame);
         Self {
-            polars_handle: PolarsHandle::new(handle, ContextType::LazyGroupBy),
+            polars_handle: PolarsHandle::new(handle, context_type),
             error_code: 0,
             error_message: ptr::null_mut(),
             error_frame: 0,
         }
     }
 
+    /// Error for handles that are stale, released, or of an unexpected type
+    pub fn invalid_handle() -> Self {
+        Self::error(ERROR_NULL_HANDLE, "Invalid or released handle")
+    }
+
     /// Create a successful result with a specific handle (for expression operations)
     pub fn success_with_handle(handle: usize, context_type: ContextType) -> Self {
         Self {
@@ -146,6 +179,30 @@ pub struct WindowOffsetArgs {
     pub offset: c_int, // For Lag/Lead functions (positive for Lead, negative for Lag)
 }
 
+/// Rolling window arguments for RollingSum/Mean/Min/Max/Std
+/// Without `by` each window is the last window_size rows; with `by` it is the
+/// `duration` ending at each row of that sorted temporal column.
+#[repr(C)]
+pub struct RollingExprArgs {
+    pub window_size: usize, // Rows per window (fixed windows)
+    pub min_periods: usize, // Non-null values required for a result (0 = window_size, 1 with by)
+    pub center: bool,       // Label fixed windows at their center instead of their last row
+    pub ddof: u8,           // Delta degrees of freedom (RollingStd only)
+    pub by: RawStr,         // Sorted temporal column for duration windows (empty = fixed)
+    pub duration: RawStr,   // Window length with by, in the Polars duration language
+    pub closed: WindowClosed, // Duration window edges (default right)
+}
+
+/// Exponentially weighted moving average arguments for EwmMean/EwmStd
+#[repr(C)]
+pub struct EwmArgs {
+    pub alpha: f64,         // Smoothing factor, 0 < alpha <= 1
+    pub adjust: bool,       // Divide by the decaying weight sum (true) or use the recursive form
+    pub bias: bool,         // EwmStd without the bias correction
+    pub min_periods: usize, // Values required before a result is produced
+    pub ignore_nulls: bool, // Skip nulls when computing weights
+}
+
 /// Helper function to convert RawStr array to Vec<String>
 
 /// Join types supported by Polars
@@ -157,6 +214,37 @@ pub enum JoinType {
     Right = 2,
     Outer = 3,
     Cross = 4,
+    Semi = 5,  // Left rows with a match; no right columns
+    Anti = 6,  // Left rows without a match; no right columns
+    AsOf = 7,  // Nearest-key match on one sorted column (see AsofArgs)
+}
+
+/// Key uniqueness checked by a join before it runs
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub enum JoinValidation {
+    ManyToMany = 0, // No check
+    ManyToOne = 1,  // Right keys are unique
+    OneToMany = 2,  // Left keys are unique
+    OneToOne = 3,   // Keys are unique on both sides
+}
+
+/// Direction of an asof join match
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub enum AsofStrategy {
+    Backward = 0, // Last right key <= left key
+    Forward = 1,  // First right key >= left key
+    Nearest = 2,  // Closest right key
+}
+
+/// Asof join options
+#[repr(C)]
+pub struct AsofArgs {
+    pub strategy: AsofStrategy,
+    pub tolerance: RawStr,  // Max key distance: a number, or a duration like "5m" (empty = unbounded)
+    pub by: *const RawStr,  // Columns that must match exactly before the asof match
+    pub by_count: usize,
 }
 
 /// Arguments for join operations
@@ -169,6 +257,9 @@ pub struct JoinArgs {
     pub how: JoinType,           // Join type (inner, left, etc.)
     pub suffix: RawStr,          // Optional suffix for duplicate columns
     pub coalesce: bool,          // Whether to coalesce join columns (default false)
+    pub validation: JoinValidation, // Key uniqueness to check (default none)
+    pub sorted_keys: bool,       // Keys are sorted ascending on both sides - skip sortedness checks
+    pub asof: *const AsofArgs,   // Required for JoinType::AsOf, ignored otherwise
 }
 
 /// Helper function to create RawStr from Go string data
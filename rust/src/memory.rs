@@ -0,0 +1,143 @@
+use crate::registry::{handle_stats, registered_dataframe};
+use std::alloc::{GlobalAlloc, Layout};
+use std::os::raw::c_int;
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+
+#[cfg(all(feature = "mimalloc", feature = "jemalloc"))]
+compile_error!("features \"mimalloc\" and \"jemalloc\" are mutually exclusive");
+
+// The base allocator is installed directly unless alloc-stats wraps it in Tracking
+#[cfg(all(feature = "mimalloc", not(feature = "alloc-stats")))]
+#[global_allocator]
+static ALLOCATOR: mimalloc::MiMalloc = mimalloc::MiMalloc;
+
+#[cfg(all(feature = "jemalloc", not(feature = "alloc-stats")))]
+#[global_allocator]
+static ALLOCATOR: tikv_jemallocator::Jemalloc = tikv_jemallocator::Jemalloc;
+
+#[cfg(all(feature = "alloc-stats", feature = "mimalloc"))]
+#[global_allocator]
+static ALLOCATOR: Tracking<mimalloc::MiMalloc> = Tracking(mimalloc::MiMalloc);
+
+#[cfg(all(feature = "alloc-stats", feature = "jemalloc"))]
+#[global_allocator]
+static ALLOCATOR: Tracking<tikv_jemallocator::Jemalloc> = Tracking(tikv_jemallocator::Jemalloc);
+
+#[cfg(all(
+    feature = "alloc-stats",
+    not(any(feature = "mimalloc", feature = "jemalloc"))
+))]
+#[global_allocator]
+static ALLOCATOR: Tracking<std::alloc::System> = Tracking(std::alloc::System);
+
+static ALLOCATED: AtomicUsize = AtomicUsize::new(0);
+static PEAK: AtomicUsize = AtomicUsize::new(0);
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+
+/// Global allocator wrapper that counts the bytes live on the Rust heap
+/// Only installed with the alloc-stats feature: every allocation does two shared
+/// atomic adds and every free one, which contend across Polars worker threads.
+/// The peak is only written when it actually rises, not on every allocation.
+#[cfg_attr(not(feature = "alloc-stats"), allow(dead_code))]
+pub struct Tracking<A>(A);
+
+#[cfg_attr(not(feature = "alloc-stats"), allow(dead_code))]
+impl<A> Tracking<A> {
+    fn grow(size: usize) {
+        let allocated = ALLOCATED.fetch_add(size, Ordering::Relaxed) + size;
+        if allocated > PEAK.load(Ordering::Relaxed) {
+            PEAK.fetch_max(allocated, Ordering::Relaxed);
+        }
+    }
+
+    fn shrink(size: usize) {
+        ALLOCATED.fetch_sub(size, Ordering::Relaxed);
+    }
+}
+
+unsafe impl<A: GlobalAlloc> GlobalAlloc for Tracking<A> {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        let ptr = self.0.alloc(layout);
+        if !ptr.is_null() {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            Self::grow(layout.size());
+        }
+        ptr
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        let ptr = self.0.alloc_zeroed(layout);
+        if !ptr.is_null() {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            Self::grow(layout.size());
+        }
+        ptr
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        self.0.dealloc(ptr, layout);
+        Self::shrink(layout.size());
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        let new_ptr = self.0.realloc(ptr, layout, new_size);
+        if !new_ptr.is_null() {
+            if new_size > layout.size() {
+                Self::grow(new_size - layout.size());
+            } else {
+                Self::shrink(layout.size() - new_size);
+            }
+        }
+        new_ptr
+    }
+}
+
+/// Rust-side memory counters, read through memory_stats
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct MemoryStats {
+    pub allocated_bytes: usize,   // Bytes currently allocated on the Rust heap
+    pub peak_bytes: usize,        // High-water mark of allocated_bytes (see reset_peak_memory)
+    pub allocations: u64,         // Allocations made since the library was loaded
+    pub dataframe_handles: usize, // Live handles by context type
+    pub lazy_frame_handles: usize,
+    pub lazy_group_by_handles: usize,
+    pub dataframe_bytes: usize, // Estimated size of the DataFrames held by handles
+    pub allocator_tracked: bool, // Built with alloc-stats; the allocator fields are 0 otherwise
+}
+
+/// Copy the allocator and handle counters into *out
+/// Handle counts and sizes walk the registry, so this costs O(live handles).
+#[no_mangle]
+pub extern "C" fn memory_stats(out: *mut MemoryStats) -> c_int {
+    if out.is_null() {
+        return crate::ERROR_NULL_ARGS;
+    }
+    let (counts, dataframe_bytes) = handle_stats();
+    let stats = MemoryStats {
+        allocated_bytes: ALLOCATED.load(Ordering::Relaxed),
+        peak_bytes: PEAK.load(Ordering::Relaxed),
+        allocations: ALLOCATIONS.load(Ordering::Relaxed),
+        dataframe_handles: counts.dataframes,
+        lazy_frame_handles: counts.lazy_frames,
+        lazy_group_by_handles: counts.lazy_group_bys,
+        dataframe_bytes,
+        allocator_tracked: cfg!(feature = "alloc-stats"),
+    };
+    unsafe { *out = stats };
+    0
+}
+
+/// Restart peak tracking from the current allocation level
+/// A no-op without the alloc-stats feature.
+#[no_mangle]
+pub extern "C" fn reset_peak_memory() {
+    PEAK.store(ALLOCATED.load(Ordering::Relaxed), Ordering::Relaxed);
+}
+
+/// Estimated heap size of a DataFrame handle (0 for other context types)
+/// Buffers shared with other frames are included in full.
+#[no_mangle]
+pub extern "C" fn dataframe_estimated_size(handle: usize) -> usize {
+    registered_dataframe(handle).map_or(0, |df| df.estimated_size())
+}
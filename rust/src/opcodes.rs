@@ -27,6 +27,12 @@ pub enum OpCode {
     Limit = 15,
     Query = 16,
     Join = 17,
+    ImportArrow = 18,
+    SinkParquet = 19,
+    SinkCsv = 20,
+    SinkIpc = 21,
+    GroupByDynamic = 22,
+    Rolling = 23,
 
     // Expression operations (stack-based)
     ExprColumn = 100,
@@ -80,6 +86,29 @@ pub enum OpCode {
     // Cast operations
     ExprCast = 160,       // Cast expression to specified data type
 
+    // Prepared plan parameters
+    ExprParam = 170,      // Placeholder bound by execute_prepared
+
+    // Common subexpression references
+    ExprDup = 180,        // Save the top expression into a slot, leaving it on the stack
+    ExprLoad = 181,       // Push a copy of a saved expression
+
+    // Rolling window aggregations (see RollingExprArgs)
+    ExprRollingSum = 190,
+    ExprRollingMean = 191,
+    ExprRollingMin = 192,
+    ExprRollingMax = 193,
+    ExprRollingStd = 194,
+
+    // Cumulative aggregations (no args)
+    ExprCumSum = 200,
+    ExprCumMin = 201,
+    ExprCumMax = 202,
+
+    // Exponentially weighted moving statistics (see EwmArgs)
+    ExprEwmMean = 210,
+    ExprEwmStd = 211,
+
     // Error operation for fluent API error handling
     Error = 999,
 }
@@ -105,6 +134,12 @@ impl OpCode {
             15 => Some(OpCode::Limit),
             16 => Some(OpCode::Query),
             17 => Some(OpCode::Join),
+            18 => Some(OpCode::ImportArrow),
+            19 => Some(OpCode::SinkParquet),
+            20 => Some(OpCode::SinkCsv),
+            21 => Some(OpCode::SinkIpc),
+            22 => Some(OpCode::GroupByDynamic),
+            23 => Some(OpCode::Rolling),
             100 => Some(OpCode::ExprColumn),
             101 => Some(OpCode::ExprLiteral),
             102 => Some(OpCode::ExprAdd),
@@ -149,6 +184,19 @@ impl OpCode {
             151 => Some(OpCode::ExprThen),
             152 => Some(OpCode::ExprOtherwise),
             160 => Some(OpCode::ExprCast),
+            170 => Some(OpCode::ExprParam),
+            180 => Some(OpCode::ExprDup),
+            181 => Some(OpCode::ExprLoad),
+            190 => Some(OpCode::ExprRollingSum),
+            191 => Some(OpCode::ExprRollingMean),
+            192 => Some(OpCode::ExprRollingMin),
+            193 => Some(OpCode::ExprRollingMax),
+            194 => Some(OpCode::ExprRollingStd),
+            200 => Some(OpCode::ExprCumSum),
+            201 => Some(OpCode::ExprCumMin),
+            202 => Some(OpCode::ExprCumMax),
+            210 => Some(OpCode::ExprEwmMean),
+            211 => Some(OpCode::ExprEwmStd),
             999 => Some(OpCode::Error),
             _ => None,
         }
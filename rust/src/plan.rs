@@ -0,0 +1,319 @@
+use crate::{
+    execute_operations, ContextType, FfiResult, Literal, Operation, PolarsHandle,
+    ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
+};
+use crate::registry::{get, take, unwrap_or_clone, Frame};
+use crate::runtime::admit;
+use polars::prelude::{col, DslPlan, Expr, IntoLazy, LazyFrame};
+use std::cell::RefCell;
+use std::collections::{BTreeSet, HashSet};
+use std::os::raw::c_int;
+use std::sync::Arc;
+
+/// Column-name prefix that marks a parameter slot inside a template plan
+/// Parameters are encoded as column references so they survive inside any Expr tree
+/// until execute_prepared rewrites them into literals.
+const PARAM_PREFIX: &str = "__firn_param_";
+
+thread_local! {
+    /// Parameter slots emitted while prepare_operations runs its chain (None otherwise)
+    static EMITTED: RefCell<Option<BTreeSet<usize>>> = const { RefCell::new(None) };
+}
+
+/// Build the placeholder expression for a parameter slot
+pub fn param_placeholder(index: u32) -> Expr {
+    EMITTED.with(|emitted| {
+        if let Some(slots) = emitted.borrow_mut().as_mut() {
+            slots.insert(index as usize);
+        }
+    });
+    col(format!("{}{}", PARAM_PREFIX, index))
+}
+
+/// Parameter slot of a placeholder column reference
+fn param_index(expr: &Expr) -> Option<usize> {
+    match expr {
+        Expr::Column(name) => name.strip_prefix(PARAM_PREFIX)?.parse().ok(),
+        _ => None,
+    }
+}
+
+fn has_param(expr: &Expr) -> bool {
+    expr.into_iter().any(|e| param_index(e).is_some())
+}
+
+/// A compiled operation chain: the decoded LazyFrame template plus its parameter slots
+pub struct PreparedPlan {
+    template: LazyFrame,
+    /// Template nodes (by address) whose subtree holds a placeholder; bind copies
+    /// only these and shares every other node with the template
+    sites: HashSet<usize>,
+    /// Highest parameter slot the template references
+    max_param: Option<usize>,
+}
+
+impl PreparedPlan {
+    /// Record where the template's placeholders are
+    /// Fails if a slot emitted by the chain sits in a node bind cannot rewrite (e.g.
+    /// a map function payload), which would otherwise surface as an unknown column.
+    fn new(template: LazyFrame, emitted: BTreeSet<usize>) -> std::result::Result<Self, String> {
+        let mut sites = HashSet::new();
+        let mut found = BTreeSet::new();
+        find_sites(&template.logical_plan, &mut sites, &mut found);
+
+        if let Some(index) = emitted.difference(&found).next() {
+            return Err(format!(
+                "Parameter {} is used in a plan node that prepared plans cannot bind",
+                index
+            ));
+        }
+
+        Ok(PreparedPlan { template, sites, max_param: found.last().copied() })
+    }
+
+    /// Bind parameter values into a copy of the template
+    /// Only the root and the nodes on the path to a placeholder are cloned; the
+    /// rest of the plan is shared with the template through its Arcs.
+    fn bind(&self, params: &[Expr]) -> std::result::Result<LazyFrame, String> {
+        if let Some(index) = self.max_param.filter(|&index| index >= params.len()) {
+            return Err(format!(
+                "Prepared plan references parameter {} but only {} were provided",
+                index,
+                params.len()
+            ));
+        }
+
+        let mut plan = self.template.logical_plan.clone();
+        bind_plan(&mut plan, &self.sites, params);
+        Ok(LazyFrame::from(plan).with_optimizations(self.template.get_current_optimizations()))
+    }
+}
+
+/// A plan node's bindable expressions and its children, as bind_plan walks them
+/// Arc children can be shared with the template; inline ones (Union, HConcat and
+/// ExtContext members) are copied along with their parent.
+fn plan_parts(plan: &DslPlan) -> Option<(Vec<&Expr>, Vec<&Arc<DslPlan>>, Vec<&DslPlan>)> {
+    let parts = match plan {
+        DslPlan::Filter { input, predicate } => (vec![predicate], vec![input], vec![]),
+        DslPlan::Select { expr, input, .. } => (expr.iter().collect(), vec![input], vec![]),
+        DslPlan::HStack { input, exprs, .. } => (exprs.iter().collect(), vec![input], vec![]),
+        DslPlan::GroupBy { input, keys, aggs, .. } => {
+            (keys.iter().chain(aggs.iter()).collect(), vec![input], vec![])
+        }
+        DslPlan::Sort { input, by_column, .. } => (by_column.iter().collect(), vec![input], vec![]),
+        DslPlan::Join { input_left, input_right, left_on, right_on, .. } => (
+            left_on.iter().chain(right_on.iter()).collect(),
+            vec![input_left, input_right],
+            vec![],
+        ),
+        DslPlan::Cache { input, .. }
+        | DslPlan::Distinct { input, .. }
+        | DslPlan::Slice { input, .. }
+        | DslPlan::MapFunction { input, .. }
+        | DslPlan::Sink { input, .. } => (vec![], vec![input], vec![]),
+        DslPlan::Union { inputs, .. } | DslPlan::HConcat { inputs, .. } => {
+            (vec![], vec![], inputs.iter().collect())
+        }
+        DslPlan::ExtContext { input, contexts } => (vec![], vec![input], contexts.iter().collect()),
+        // Scans and in-memory sources carry no user expressions
+        _ => return None,
+    };
+    Some(parts)
+}
+
+/// Mark the nodes whose subtree holds a placeholder; returns whether plan does
+fn find_sites(plan: &DslPlan, sites: &mut HashSet<usize>, found: &mut BTreeSet<usize>) -> bool {
+    let Some((exprs, inputs, members)) = plan_parts(plan) else { return false };
+
+    let mut any = false;
+    for expr in exprs {
+        for index in expr.into_iter().filter_map(param_index) {
+            found.insert(index);
+            any = true;
+        }
+    }
+    for input in inputs {
+        if find_sites(input, sites, found) {
+            sites.insert(Arc::as_ptr(input) as usize);
+            any = true;
+        }
+    }
+    for member in members {
+        any |= find_sites(member, sites, found);
+    }
+    any
+}
+
+/// Replace parameter placeholders in an expression with bound literals
+fn bind_expr(expr: &mut Expr, params: &[Expr]) {
+    if !has_param(expr) {
+        return;
+    }
+    *expr = std::mem::take(expr).map_expr(|e| match param_index(&e) {
+        Some(index) => params[index].clone(), // Bounds checked against max_param
+        None => e,
+    });
+}
+
+fn bind_exprs(exprs: &mut [Expr], params: &[Expr]) {
+    for expr in exprs {
+        bind_expr(expr, params);
+    }
+}
+
+/// Copy-on-write an Arc child, but only if a placeholder lies below it
+fn bind_input(input: &mut Arc<DslPlan>, sites: &HashSet<usize>, params: &[Expr]) {
+    if sites.contains(&(Arc::as_ptr(input) as usize)) {
+        bind_plan(Arc::make_mut(input), sites, params);
+    }
+}
+
+/// Walk the nodes find_sites marked and bind every expression that carries a placeholder
+fn bind_plan(plan: &mut DslPlan, sites: &HashSet<usize>, params: &[Expr]) {
+    match plan {
+        DslPlan::Filter { input, predicate } => {
+            bind_expr(predicate, params);
+            bind_input(input, sites, params);
+        }
+        DslPlan::Select { expr, input, .. } => {
+            bind_exprs(expr, params);
+            bind_input(input, sites, params);
+        }
+        DslPlan::HStack { input, exprs, .. } => {
+            bind_exprs(exprs, params);
+            bind_input(input, sites, params);
+        }
+        DslPlan::GroupBy { input, keys, aggs, .. } => {
+            bind_exprs(keys, params);
+            bind_exprs(aggs, params);
+            bind_input(input, sites, params);
+        }
+        DslPlan::Sort { input, by_column, .. } => {
+            bind_exprs(by_column, params);
+            bind_input(input, sites, params);
+        }
+        DslPlan::Join { input_left, input_right, left_on, right_on, .. } => {
+            bind_exprs(left_on, params);
+            bind_exprs(right_on, params);
+            bind_input(input_left, sites, params);
+            bind_input(input_right, sites, params);
+        }
+        DslPlan::Cache { input, .. }
+        | DslPlan::Distinct { input, .. }
+        | DslPlan::Slice { input, .. }
+        | DslPlan::MapFunction { input, .. }
+        | DslPlan::Sink { input, .. } => bind_input(input, sites, params),
+        DslPlan::Union { inputs, .. } | DslPlan::HConcat { inputs, .. } => {
+            for input in inputs {
+                bind_plan(input, sites, params);
+            }
+        }
+        DslPlan::ExtContext { input, contexts } => {
+            bind_input(input, sites, params);
+            for context in contexts {
+                bind_plan(context, sites, params);
+            }
+        }
+        // find_sites marks nothing below these (see plan_parts)
+        _ => {}
+    }
+}
+
+/// Compile an operation chain into a reusable plan
+/// Runs the ops once to decode opcodes and build the Expr/LazyFrame template; the
+/// returned FfiResult carries the PreparedPlan pointer in polars_handle.handle.
+/// Use ExprParam placeholders for values that change between executions.
+#[no_mangle]
+pub extern "C" fn prepare_operations(
+    polars_handle: PolarsHandle,
+    operations_ptr: *const Operation,
+    count: usize,
+) -> FfiResult {
+    let previous = EMITTED.with(|emitted| emitted.replace(Some(BTreeSet::new())));
+    let result = execute_operations(polars_handle, operations_ptr, count);
+    let emitted = EMITTED.with(|emitted| emitted.replace(previous)).unwrap_or_default();
+    if result.error_code != 0 {
+        return result;
+    }
+
+    let handle = result.polars_handle.handle;
+    let owned = handle != polars_handle.handle; // Never take ownership of the caller's handle
+
+    let frame = if owned { take(handle) } else { get(handle) };
+    let template = match frame {
+        Some(Frame::LazyFrame(lazy_frame)) => unwrap_or_clone(lazy_frame),
+        Some(Frame::DataFrame(df)) => unwrap_or_clone(df).lazy(),
+        Some(Frame::LazyGroupBy(_)) => {
+            return FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                "Cannot prepare grouped data. Call agg() first to resolve grouping.",
+            );
+        }
+        None => return FfiResult::invalid_handle(),
+    };
+
+    let plan = match PreparedPlan::new(template, emitted) {
+        Ok(plan) => Box::new(plan),
+        Err(msg) => return FfiResult::error(ERROR_POLARS_OPERATION, &msg),
+    };
+    FfiResult::success_with_handle(Box::into_raw(plan) as usize, ContextType::LazyFrame)
+}
+
+/// Execute a prepared plan with the given parameter values and collect the result
+/// Parameters are positional: params[i] binds to ExprParam slot i. Waits for the
+/// concurrency limit like execute_operations.
+#[no_mangle]
+pub extern "C" fn execute_prepared(
+    plan_handle: usize,
+    params_ptr: *const Literal,
+    count: usize,
+) -> FfiResult {
+    if plan_handle == 0 {
+        return FfiResult::error(ERROR_NULL_HANDLE, "Prepared plan handle cannot be null");
+    }
+    if params_ptr.is_null() && count > 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "Parameters cannot be null");
+    }
+
+    let plan = unsafe { &*(plan_handle as *const PreparedPlan) };
+
+    let literals = if count > 0 {
+        unsafe { std::slice::from_raw_parts(params_ptr, count) }
+    } else {
+        &[]
+    };
+
+    let mut params = Vec::with_capacity(count);
+    for literal in literals {
+        match literal.to_expr() {
+            Ok(expr) => params.push(expr),
+            Err(msg) => return FfiResult::error(ERROR_POLARS_OPERATION, msg),
+        }
+    }
+
+    let lazy_frame = match plan.bind(&params) {
+        Ok(lf) => lf,
+        Err(msg) => return FfiResult::error(ERROR_POLARS_OPERATION, &msg),
+    };
+
+    let _admission = match admit() {
+        Ok(admission) => admission,
+        Err(stopped) => return stopped,
+    };
+
+    match lazy_frame.collect() {
+        Ok(df) => FfiResult::success(df),
+        Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+    }
+}
+
+/// Release a prepared plan
+#[no_mangle]
+pub extern "C" fn release_prepared_plan(plan_handle: usize) -> c_int {
+    if plan_handle != 0 {
+        unsafe {
+            let _ = Box::from_raw(plan_handle as *mut PreparedPlan);
+        }
+    }
+    0
+}
@@ -0,0 +1,162 @@
+use crate::registry::registered_dataframe;
+use crate::{ContextType, PolarsHandle, RawStr};
+use polars::prelude::{DataFrame, LazyFrame, PolarsResult};
+use std::cell::RefCell;
+use std::time::Instant;
+
+/// Profile of one op frame
+/// Row counts and sizes are only known for materialized frames; they are -1 for
+/// lazy and grouped contexts and for expression ops.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct FrameProfile {
+    pub opcode: u32,
+    pub wall_ns: u64,         // Time spent dispatching this op
+    pub input_rows: i64,      // Rows of the input frame (-1 if not materialized)
+    pub output_rows: i64,     // Rows of the result frame (-1 if not materialized)
+    pub estimated_bytes: i64, // Estimated heap size of the result frame (-1 if not materialized)
+}
+
+/// Polars' own timing of one physical plan node, from LazyFrame::profile
+#[repr(C)]
+pub struct NodeTiming {
+    pub name: RawStr, // Node description, owned by the profile
+    pub start_us: u64,
+    pub end_us: u64,
+}
+
+/// Profile of one execute call, handed to the caller as an opaque handle
+#[derive(Default)]
+pub struct Profile {
+    frames: Vec<FrameProfile>,
+    node_names: Vec<String>,
+    node_times: Vec<(u64, u64)>,
+    nodes: Vec<NodeTiming>, // Built by finish_profile, pointing into node_names
+}
+
+thread_local! {
+    static CURRENT: RefCell<Option<Profile>> = const { RefCell::new(None) };
+}
+
+/// Row count and estimated size of a handle, if it is a materialized DataFrame
+fn frame_stats(handle: PolarsHandle) -> (i64, i64) {
+    match handle.get_context_type() {
+        Some(ContextType::DataFrame) => registered_dataframe(handle.handle)
+            .map_or((-1, -1), |df| {
+                (df.height() as i64, df.estimated_size() as i64)
+            }),
+        _ => (-1, -1),
+    }
+}
+
+/// Start recording a profile on this thread
+pub(crate) fn start_profile() {
+    CURRENT.with(|current| *current.borrow_mut() = Some(Profile::default()));
+}
+
+/// Stop recording and return the profile with its node timings ready to read
+pub(crate) fn finish_profile() -> Option<Profile> {
+    let mut profile = CURRENT.with(|current| current.borrow_mut().take())?;
+    profile.nodes = profile
+        .node_names
+        .iter()
+        .zip(&profile.node_times)
+        .map(|(name, &(start_us, end_us))| NodeTiming {
+            name: RawStr {
+                data: name.as_ptr() as *const _,
+                len: name.len(),
+            },
+            start_us,
+            end_us,
+        })
+        .collect();
+    Some(profile)
+}
+
+pub(crate) fn profiling() -> bool {
+    CURRENT.with(|current| current.borrow().is_some())
+}
+
+/// Start timing an op frame; None when profiling is off
+pub(crate) fn frame_start(input: PolarsHandle) -> Option<(Instant, i64)> {
+    profiling().then(|| (Instant::now(), frame_stats(input).0))
+}
+
+/// Record an op frame started with frame_start
+pub(crate) fn frame_end(start: Option<(Instant, i64)>, opcode: u32, output: Option<PolarsHandle>) {
+    let Some((started, input_rows)) = start else {
+        return;
+    };
+    let wall_ns = started.elapsed().as_nanos() as u64;
+    let (output_rows, estimated_bytes) = output.map_or((-1, -1), frame_stats);
+
+    CURRENT.with(|current| {
+        if let Some(profile) = current.borrow_mut().as_mut() {
+            profile.frames.push(FrameProfile {
+                opcode,
+                wall_ns,
+                input_rows,
+                output_rows,
+                estimated_bytes,
+            });
+        }
+    });
+}
+
+/// Collect through LazyFrame::profile when profiling, recording the node timings
+pub(crate) fn collect_profiled(lazy_frame: LazyFrame) -> PolarsResult<DataFrame> {
+    if !profiling() {
+        return lazy_frame.collect();
+    }
+
+    let (df, timings) = lazy_frame.profile()?;
+    let names = timings.column("node")?.str()?;
+    let starts = timings.column("start")?.u64()?;
+    let ends = timings.column("end")?.u64()?;
+
+    CURRENT.with(|current| {
+        if let Some(profile) = current.borrow_mut().as_mut() {
+            for ((name, start), end) in names.into_iter().zip(starts).zip(ends) {
+                profile
+                    .node_names
+                    .push(name.unwrap_or_default().to_string());
+                profile
+                    .node_times
+                    .push((start.unwrap_or_default(), end.unwrap_or_default()));
+            }
+        }
+    });
+    Ok(df)
+}
+
+/// Frame profiles of a profile handle; the array lives until release_profile
+#[no_mangle]
+pub extern "C" fn profile_frames(profile: usize, out_count: *mut usize) -> *const FrameProfile {
+    if profile == 0 || out_count.is_null() {
+        return std::ptr::null();
+    }
+    let profile = unsafe { &*(profile as *const Profile) };
+    unsafe { *out_count = profile.frames.len() };
+    profile.frames.as_ptr()
+}
+
+/// Polars node timings of a profile handle; the array lives until release_profile
+#[no_mangle]
+pub extern "C" fn profile_nodes(profile: usize, out_count: *mut usize) -> *const NodeTiming {
+    if profile == 0 || out_count.is_null() {
+        return std::ptr::null();
+    }
+    let profile = unsafe { &*(profile as *const Profile) };
+    unsafe { *out_count = profile.nodes.len() };
+    profile.nodes.as_ptr()
+}
+
+/// Release a profile handle
+#[no_mangle]
+pub extern "C" fn release_profile(profile: usize) {
+    if profile != 0 {
+        unsafe {
+            let _ = Box::from_raw(profile as *mut Profile);
+        }
+    }
+}
@@ -0,0 +1,112 @@
+use crate::batch::{prepare_plan, Pending, PlanDesc};
+use crate::registry::unwrap_or_clone;
+use crate::runtime::{admit, Slot};
+use crate::{ContextType, FfiResult, Operation, PolarsHandle, ERROR_POLARS_OPERATION};
+use polars::prelude::{InProcessQuery, IntoLazy};
+use std::os::raw::c_int;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Mutex;
+
+/// A query running on the Polars thread pool
+/// `fetched` records that the result channel has been drained, so release knows
+/// whether it still has to wait for the worker. `slot` counts the query against
+/// the concurrency limit until its result is fetched or the ticket released.
+pub struct AsyncQuery {
+    query: InProcessQuery,
+    fetched: AtomicBool,
+    slot: Mutex<Option<Slot>>,
+}
+
+/// Start collecting an operation chain in the background and return immediately
+///
+/// The ops (without a trailing Collect) are decoded synchronously, so Go-owned
+/// argument memory only has to outlive this call. The query itself runs on the
+/// Polars thread pool; the calling thread is not blocked while it executes.
+/// The returned FfiResult carries the query ticket in polars_handle.handle.
+/// Submitting waits for the concurrency limit like execute_operations.
+#[no_mangle]
+pub extern "C" fn submit_query(
+    polars_handle: PolarsHandle,
+    operations_ptr: *const Operation,
+    count: usize,
+) -> FfiResult {
+    let admission = match admit() {
+        Ok(admission) => admission,
+        Err(stopped) => return stopped,
+    };
+    let plan = PlanDesc {
+        handle: polars_handle,
+        operations: operations_ptr,
+        count,
+    };
+
+    let lazy_frame = match prepare_plan(&plan) {
+        Pending::Done(result) => return result,
+        Pending::Ready(df) => unwrap_or_clone(df).lazy(),
+        Pending::Collect(lf) => lf,
+    };
+
+    match lazy_frame.collect_concurrently() {
+        Ok(query) => {
+            let query = Box::new(AsyncQuery {
+                query,
+                fetched: AtomicBool::new(false),
+                slot: Mutex::new(admission.detach()),
+            });
+            FfiResult::success_with_handle(Box::into_raw(query) as usize, ContextType::DataFrame)
+        }
+        Err(e) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+    }
+}
+
+/// Check a submitted query without blocking
+/// Returns true and writes the DataFrame handle (or error) to out_result once the
+/// query has finished; returns false while it is still running. The result can be
+/// fetched only once.
+#[no_mangle]
+pub extern "C" fn poll_query(ticket: usize, out_result: *mut FfiResult) -> bool {
+    if ticket == 0 || out_result.is_null() {
+        return false;
+    }
+
+    let query = unsafe { &*(ticket as *const AsyncQuery) };
+    if query.fetched.load(Ordering::Acquire) {
+        return false;
+    }
+    let result = match query.query.fetch() {
+        Some(Ok(df)) => FfiResult::success(df),
+        Some(Err(e)) => FfiResult::error(ERROR_POLARS_OPERATION, &e.to_string()),
+        None => return false,
+    };
+
+    query.fetched.store(true, Ordering::Release);
+    drop(query.slot.lock().unwrap_or_else(|e| e.into_inner()).take()); // Finished running
+    unsafe { std::ptr::write(out_result, result) };
+    true
+}
+
+/// Ask a running query to stop
+/// Polars checks the stop flag between physical operators, so the query finishes
+/// early with an error result (fetched by poll_query or discarded by release_query).
+#[no_mangle]
+pub extern "C" fn cancel_query(ticket: usize) {
+    if ticket != 0 {
+        let query = unsafe { &*(ticket as *const AsyncQuery) };
+        query.query.cancel();
+    }
+}
+
+/// Release a query ticket
+/// A query that is still running is cancelled first and its (error or late)
+/// result discarded, so this waits for the worker to reach a stop point.
+#[no_mangle]
+pub extern "C" fn release_query(ticket: usize) -> c_int {
+    if ticket != 0 {
+        let query = unsafe { Box::from_raw(ticket as *mut AsyncQuery) };
+        if !query.fetched.load(Ordering::Acquire) {
+            query.query.cancel();
+            let _ = query.query.fetch_blocking();
+        }
+    }
+    0
+}
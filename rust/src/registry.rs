@@ -0,0 +1,316 @@
+use crate::{ContextType, PolarsHandle};
+use polars::prelude::{DataFrame, IntoLazy, LazyFrame, LazyGroupBy};
+use std::cell::Cell;
+use std::collections::HashSet;
+use std::os::raw::c_int;
+use std::sync::{Arc, RwLock};
+
+/// A frame owned by the handle registry, tagged with its real type
+#[derive(Clone)]
+pub enum Frame {
+    DataFrame(Arc<DataFrame>),
+    LazyFrame(Arc<LazyFrame>),
+    LazyGroupBy(Arc<LazyGroupBy>),
+}
+
+impl Frame {
+    pub fn context_type(&self) -> ContextType {
+        match self {
+            Frame::DataFrame(_) => ContextType::DataFrame,
+            Frame::LazyFrame(_) => ContextType::LazyFrame,
+            Frame::LazyGroupBy(_) => ContextType::LazyGroupBy,
+        }
+    }
+}
+
+/// One registry entry; the generation is bumped every time the slot is freed
+struct Slot {
+    generation: u32,
+    refs: u32,
+    frame: Option<Frame>,
+}
+
+/// Generational slab of frames
+///
+/// Handles encode `(generation << 32) | (index + 1)`, so a handle is never 0 and a
+/// stale handle (released, then its slot reused) fails lookup instead of aliasing a
+/// different frame. Freed slots are recycled, which keeps the slab bounded by the
+/// peak number of live handles.
+struct Registry {
+    slots: Vec<Slot>,
+    free: Vec<u32>,
+    live: usize,
+}
+
+static REGISTRY: RwLock<Registry> = RwLock::new(Registry {
+    slots: Vec::new(),
+    free: Vec::new(),
+    live: 0,
+});
+
+fn encode(index: u32, generation: u32) -> usize {
+    (((generation as u64) << 32) | (index as u64 + 1)) as usize
+}
+
+fn decode(handle: usize) -> Option<(usize, u32)> {
+    let handle = handle as u64;
+    let index = (handle & 0xFFFF_FFFF).checked_sub(1)?;
+    Some((index as usize, (handle >> 32) as u32))
+}
+
+impl Registry {
+    fn slot(&self, handle: usize) -> Option<&Slot> {
+        let (index, generation) = decode(handle)?;
+        self.slots
+            .get(index)
+            .filter(|slot| slot.generation == generation && slot.frame.is_some())
+    }
+
+    fn slot_mut(&mut self, handle: usize) -> Option<&mut Slot> {
+        let (index, generation) = decode(handle)?;
+        self.slots
+            .get_mut(index)
+            .filter(|slot| slot.generation == generation && slot.frame.is_some())
+    }
+}
+
+fn read() -> std::sync::RwLockReadGuard<'static, Registry> {
+    REGISTRY.read().unwrap_or_else(|poisoned| poisoned.into_inner())
+}
+
+fn write() -> std::sync::RwLockWriteGuard<'static, Registry> {
+    REGISTRY.write().unwrap_or_else(|poisoned| poisoned.into_inner())
+}
+
+/// Register a frame and return its handle (reference count 1)
+pub fn insert(frame: Frame) -> usize {
+    let mut registry = write();
+    registry.live += 1;
+
+    if let Some(index) = registry.free.pop() {
+        let slot = &mut registry.slots[index as usize];
+        slot.refs = 1;
+        slot.frame = Some(frame);
+        return encode(index, slot.generation);
+    }
+
+    let index = registry.slots.len() as u32;
+    registry.slots.push(Slot {
+        generation: 1,
+        refs: 1,
+        frame: Some(frame),
+    });
+    encode(index, 1)
+}
+
+/// Look up a live handle, sharing the frame (no copy)
+pub fn get(handle: usize) -> Option<Frame> {
+    read().slot(handle).and_then(|slot| slot.frame.clone())
+}
+
+/// Increment the reference count of a live handle
+pub fn retain(handle: usize) -> bool {
+    match write().slot_mut(handle) {
+        Some(slot) => {
+            slot.refs += 1;
+            true
+        }
+        None => false,
+    }
+}
+
+/// Decrement the reference count, dropping the frame by its real type at zero
+/// Returns false for unknown or already released handles.
+pub fn release(handle: usize) -> bool {
+    let dropped = {
+        let mut registry = write();
+        let index = match decode(handle) {
+            Some((index, _)) => index,
+            None => return false,
+        };
+        let slot = match registry.slot_mut(handle) {
+            Some(slot) => slot,
+            None => return false,
+        };
+
+        slot.refs -= 1;
+        if slot.refs > 0 {
+            return true;
+        }
+
+        slot.generation = slot.generation.wrapping_add(1).max(1);
+        let frame = slot.frame.take();
+        registry.free.push(index as u32);
+        registry.live -= 1;
+        frame
+    };
+
+    // Drop outside the lock - freeing a large frame should not block other lookups
+    drop(dropped);
+    true
+}
+
+/// Release a handle and return its frame
+/// Once the registry has dropped its reference, unwrap_or_clone moves the frame out
+/// unless another handle, join or plan still shares it.
+pub fn take(handle: usize) -> Option<Frame> {
+    let frame = get(handle)?;
+    release(handle);
+    Some(frame)
+}
+
+thread_local! {
+    // The marked intermediate, and whether the running op has already taken it
+    static CONSUMABLE: Cell<(usize, bool)> = const { Cell::new((0, false)) };
+}
+
+/// Marks the current intermediate of an op chain as consumed by the running op
+/// Only execute_operations can reach an intermediate handle, so the op takes its
+/// frame out of the registry instead of sharing it, and unwrap_or_clone can then
+/// move it; the loop's release of the old handle is a no-op afterwards.
+/// An op resolves its input once: a second lookup after the take is a bug
+/// (debug_assert), and in release builds fails as a stale handle.
+pub(crate) struct ConsumeGuard {
+    previous: (usize, bool),
+}
+
+impl ConsumeGuard {
+    pub(crate) fn mark(handle: usize) -> Self {
+        ConsumeGuard {
+            previous: CONSUMABLE.with(|consumable| consumable.replace((handle, false))),
+        }
+    }
+}
+
+impl Drop for ConsumeGuard {
+    fn drop(&mut self) {
+        CONSUMABLE.with(|consumable| consumable.set(self.previous));
+    }
+}
+
+/// Resolve an op's input handle: taken if it is the marked intermediate, else shared
+/// A frame of the wrong type is never taken, so the handle stays registered.
+fn lookup(handle: usize, wanted: fn(&Frame) -> bool) -> Option<Frame> {
+    let (marked, taken) = CONSUMABLE.with(|consumable| consumable.get());
+    if handle == 0 || handle != marked {
+        return get(handle).filter(wanted);
+    }
+    debug_assert!(!taken, "op resolved its consumed input handle {handle:#x} twice");
+    if taken {
+        return None; // Never release the intermediate twice
+    }
+    let frame = get(handle).filter(wanted)?;
+    CONSUMABLE.with(|consumable| consumable.set((marked, true)));
+    release(handle);
+    Some(frame)
+}
+
+/// Number of live handles - used to detect leaks in long-running processes
+pub fn live_handles() -> usize {
+    read().live
+}
+
+/// Live handle counts by context type, plus the estimated heap size of the
+/// distinct DataFrames they hold (a frame shared by several handles counts once)
+pub fn handle_stats() -> (HandleCounts, usize) {
+    let mut counts = HandleCounts::default();
+    let mut frames = Vec::new();
+    for frame in read().slots.iter().filter_map(|slot| slot.frame.as_ref()) {
+        match frame {
+            Frame::DataFrame(df) => {
+                counts.dataframes += 1;
+                frames.push(df.clone());
+            }
+            Frame::LazyFrame(_) => counts.lazy_frames += 1,
+            Frame::LazyGroupBy(_) => counts.lazy_group_bys += 1,
+        }
+    }
+
+    // Sized outside the lock - walking every chunk should not block other lookups
+    let mut seen = HashSet::new();
+    let bytes = frames
+        .iter()
+        .filter(|df| seen.insert(Arc::as_ptr(df)))
+        .map(|df| df.estimated_size())
+        .sum();
+    (counts, bytes)
+}
+
+/// Live handles per context type
+#[derive(Default)]
+pub struct HandleCounts {
+    pub dataframes: usize,
+    pub lazy_frames: usize,
+    pub lazy_group_bys: usize,
+}
+
+/// Accessors for the input of an op
+/// Caller handles stay registered, so their frames are shared and unwrap_or_clone
+/// copies them (shallowly: columns and plans are reference counted); a chain
+/// intermediate marked by ConsumeGuard is taken and can be moved instead.
+impl PolarsHandle {
+    /// Resolve the handle to a DataFrame (None if stale or not a DataFrame)
+    pub fn dataframe(&self) -> Option<Arc<DataFrame>> {
+        match lookup(self.handle, |frame| matches!(frame, Frame::DataFrame(_)))? {
+            Frame::DataFrame(df) => Some(df),
+            _ => None,
+        }
+    }
+
+    /// Resolve the handle to a LazyFrame (None if stale or not a LazyFrame)
+    pub fn lazy_frame(&self) -> Option<Arc<LazyFrame>> {
+        match lookup(self.handle, |frame| matches!(frame, Frame::LazyFrame(_)))? {
+            Frame::LazyFrame(lf) => Some(lf),
+            _ => None,
+        }
+    }
+
+    /// Resolve the handle to a LazyGroupBy (None if stale or not a LazyGroupBy)
+    pub fn lazy_group_by(&self) -> Option<Arc<LazyGroupBy>> {
+        match lookup(self.handle, |frame| matches!(frame, Frame::LazyGroupBy(_)))? {
+            Frame::LazyGroupBy(gb) => Some(gb),
+            _ => None,
+        }
+    }
+}
+
+/// Resolve a bare handle (e.g. from dataframe_to_csv) to a shared DataFrame
+pub fn registered_dataframe(handle: usize) -> Option<Arc<DataFrame>> {
+    match get(handle)? {
+        Frame::DataFrame(df) => Some(df),
+        _ => None,
+    }
+}
+
+/// Resolve a DataFrame or LazyFrame handle to a LazyFrame, whatever its context
+/// Used for secondary inputs such as the right side of a join or concat members.
+pub fn to_lazy(handle: usize) -> Option<LazyFrame> {
+    match get(handle)? {
+        Frame::DataFrame(df) => Some(unwrap_or_clone(df).lazy()),
+        Frame::LazyFrame(lf) => Some(unwrap_or_clone(lf)),
+        Frame::LazyGroupBy(_) => None,
+    }
+}
+
+/// Take an owned value out of a frame, cloning only if it is still shared
+/// (by the registry itself for caller handles, or by another holder)
+pub fn unwrap_or_clone<T: Clone>(shared: Arc<T>) -> T {
+    Arc::try_unwrap(shared).unwrap_or_else(|shared| (*shared).clone())
+}
+
+/// Add a reference to a handle so it can be shared between owners
+/// Each retain must be balanced by a release_dataframe call.
+#[no_mangle]
+pub extern "C" fn retain_handle(handle: usize) -> c_int {
+    if retain(handle) {
+        0
+    } else {
+        crate::ERROR_NULL_HANDLE
+    }
+}
+
+/// Number of live registry handles
+#[no_mangle]
+pub extern "C" fn live_handle_count() -> usize {
+    live_handles()
+}
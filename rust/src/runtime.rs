@@ -0,0 +1,223 @@
+use crate::interrupt::check_interrupt;
+use crate::{ContextType, FfiResult, ERROR_NULL_ARGS, ERROR_POLARS_OPERATION};
+use once_cell::sync::Lazy;
+use polars_core::POOL;
+use std::cell::Cell;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Condvar, Mutex};
+use std::time::Duration;
+
+/// How often a call waiting for admission polls its stop conditions
+const ADMISSION_POLL: Duration = Duration::from_millis(1);
+
+/// Process-wide runtime settings, applied once by firn_init
+/// All fields are optional; zeroed settings keep the Polars defaults.
+#[repr(C)]
+pub struct FirnConfig {
+    pub num_threads: usize, // Polars thread pool size (0 = POLARS_MAX_THREADS or one per core)
+    pub stack_size: usize,  // Worker thread stack size in bytes (0 = Rust default)
+    pub cpus: *const usize, // Cores to pin pool workers to, round robin (null for none)
+    pub cpu_count: usize,   // Number of entries in cpus
+    pub max_concurrent: usize, // Default limit on concurrently executing calls (0 = unlimited)
+}
+
+static INITIALIZED: Mutex<bool> = Mutex::new(false);
+static DEFAULT_LIMIT: AtomicUsize = AtomicUsize::new(0);
+
+/// Execute calls currently running, shared by every admission limit
+/// Unlimited calls only touch the counter; the mutex and condvar are for calls
+/// waiting on a limit, and a finishing call only notifies while one is waiting.
+static RUNNING: AtomicUsize = AtomicUsize::new(0);
+static WAITING: AtomicUsize = AtomicUsize::new(0);
+static WAIT_LOCK: Mutex<()> = Mutex::new(());
+static FINISHED: Condvar = Condvar::new();
+
+thread_local! {
+    static CALL_LIMIT: Cell<usize> = const { Cell::new(0) };
+    static ADMITTED: Cell<bool> = const { Cell::new(false) };
+}
+
+/// Configure the Polars thread pool and the default concurrency limit
+/// Polars builds its pool on first use, so this must run before any query; once
+/// the pool is running, a thread count or stack size fails the call instead of
+/// being ignored. Succeeds at most once.
+#[no_mangle]
+pub extern "C" fn firn_init(config: *const FirnConfig) -> FfiResult {
+    if config.is_null() {
+        return FfiResult::error(ERROR_NULL_ARGS, "Config cannot be null");
+    }
+    let config = unsafe { &*config };
+    let cpus = if config.cpus.is_null() || config.cpu_count == 0 {
+        &[][..]
+    } else {
+        unsafe { std::slice::from_raw_parts(config.cpus, config.cpu_count) }
+    };
+
+    let mut initialized = INITIALIZED.lock().unwrap_or_else(|e| e.into_inner());
+    if *initialized {
+        return FfiResult::error(ERROR_POLARS_OPERATION, "firn_init was already called");
+    }
+
+    // POOL reads its size from the environment when it is first touched. Once it
+    // runs, the settings could not take effect, and other threads may be reading
+    // the environment, so the variables are only set before the pool starts.
+    if config.num_threads > 0 || config.stack_size > 0 {
+        if let Some(pool) = Lazy::get(&POOL) {
+            return FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                &format!(
+                    "Polars thread pool already started with {} threads (call firn_init first)",
+                    pool.current_num_threads()
+                ),
+            );
+        }
+    }
+    if config.num_threads > 0 {
+        std::env::set_var("POLARS_MAX_THREADS", config.num_threads.to_string());
+    }
+    if config.stack_size > 0 {
+        std::env::set_var("RUST_MIN_STACK", config.stack_size.to_string());
+    }
+
+    if !cpus.is_empty() {
+        let pinned = POOL.broadcast(|worker| {
+            // Round robin, so a short list still covers every worker
+            pin_current_thread(cpus[worker.index() % cpus.len()])
+        });
+        if let Some(Err(message)) = pinned.into_iter().find(Result::is_err) {
+            return FfiResult::error(ERROR_POLARS_OPERATION, &message);
+        }
+    }
+
+    DEFAULT_LIMIT.store(config.max_concurrent, Ordering::Relaxed);
+    *initialized = true;
+    FfiResult::success_with_handle(0, ContextType::DataFrame)
+}
+
+#[cfg(target_os = "linux")]
+fn pin_current_thread(cpu: usize) -> Result<(), String> {
+    if cpu >= libc::CPU_SETSIZE as usize {
+        return Err(format!("CPU {} is out of range", cpu));
+    }
+    unsafe {
+        let mut set: libc::cpu_set_t = std::mem::zeroed();
+        libc::CPU_SET(cpu, &mut set);
+        if libc::sched_setaffinity(0, std::mem::size_of::<libc::cpu_set_t>(), &set) != 0 {
+            return Err(format!(
+                "Cannot pin worker to CPU {}: {}",
+                cpu,
+                std::io::Error::last_os_error()
+            ));
+        }
+    }
+    Ok(())
+}
+
+#[cfg(not(target_os = "linux"))]
+fn pin_current_thread(_cpu: usize) -> Result<(), String> {
+    Err("CPU pinning is only supported on Linux".to_string())
+}
+
+/// Installs the concurrency limit for the duration of one execute call
+pub(crate) struct LimitGuard {
+    previous: usize,
+}
+
+impl LimitGuard {
+    /// A zero limit falls back to the default set by firn_init
+    pub(crate) fn install(max_concurrent: usize) -> Self {
+        LimitGuard {
+            previous: CALL_LIMIT.with(|limit| limit.replace(max_concurrent)),
+        }
+    }
+}
+
+impl Drop for LimitGuard {
+    fn drop(&mut self) {
+        CALL_LIMIT.with(|limit| limit.set(self.previous));
+    }
+}
+
+/// Counts one call as running until dropped
+pub(crate) struct Slot;
+
+impl Drop for Slot {
+    fn drop(&mut self) {
+        RUNNING.fetch_sub(1, Ordering::SeqCst);
+        if WAITING.load(Ordering::SeqCst) > 0 {
+            let _lock = WAIT_LOCK.lock().unwrap_or_else(|e| e.into_inner());
+            FINISHED.notify_all();
+        }
+    }
+}
+
+/// Admission of the current call, held for its duration
+/// The thread stays marked as admitted, so calls nested in it (the op chains of a
+/// batch or a submitted query) run on its slot instead of waiting for another.
+pub(crate) struct Admission {
+    outermost: bool,    // Set the thread's admitted mark (false for nested calls)
+    slot: Option<Slot>, // Released with the admission unless detached
+}
+
+impl Admission {
+    /// Keep counting the call after this thread returns (e.g. a background query)
+    pub(crate) fn detach(mut self) -> Option<Slot> {
+        self.slot.take()
+    }
+}
+
+impl Drop for Admission {
+    fn drop(&mut self) {
+        if self.outermost {
+            ADMITTED.with(|admitted| admitted.set(false));
+        }
+    }
+}
+
+/// Wait until fewer calls than the current limit are running, then join them
+/// Every call is counted, but only calls with a limit wait; a call stopped by
+/// cancellation or its deadline while waiting returns the interrupt error. Calls
+/// nested in an admitted one are not counted again. Without a limit, admission is
+/// a single atomic add.
+pub(crate) fn admit() -> Result<Admission, FfiResult> {
+    if ADMITTED.with(|admitted| admitted.get()) {
+        return Ok(Admission {
+            outermost: false,
+            slot: None,
+        });
+    }
+
+    let limit = match CALL_LIMIT.with(|limit| limit.get()) {
+        0 => DEFAULT_LIMIT.load(Ordering::Relaxed),
+        limit => limit,
+    };
+
+    if limit == 0 {
+        RUNNING.fetch_add(1, Ordering::SeqCst);
+    } else {
+        while RUNNING
+            .fetch_update(Ordering::SeqCst, Ordering::SeqCst, |running| {
+                (running < limit).then_some(running + 1)
+            })
+            .is_err()
+        {
+            if let Some(stopped) = check_interrupt() {
+                return Err(stopped);
+            }
+            // Registered before the re-check, so a call finishing after it notifies
+            let lock = WAIT_LOCK.lock().unwrap_or_else(|e| e.into_inner());
+            WAITING.fetch_add(1, Ordering::SeqCst);
+            if RUNNING.load(Ordering::SeqCst) >= limit {
+                let _ = FINISHED
+                    .wait_timeout(lock, ADMISSION_POLL)
+                    .unwrap_or_else(|e| e.into_inner());
+            }
+            WAITING.fetch_sub(1, Ordering::SeqCst);
+        }
+    }
+    ADMITTED.with(|admitted| admitted.set(true));
+    Ok(Admission {
+        outermost: true,
+        slot: Some(Slot),
+    })
+}
@@ -0,0 +1,103 @@
+use crate::registry::{self, unwrap_or_clone, Frame};
+use crate::types::{encode_data_type, SchemaField};
+use crate::{PolarsHandle, RawStr, ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION};
+use polars::prelude::{Expr, Schema};
+use std::ffi::CString;
+use std::os::raw::{c_char, c_int};
+use std::ptr;
+
+/// Schema of a handle, filled by dataframe_schema
+#[repr(C)]
+pub struct SchemaBuffer {
+    pub fields: *const SchemaField, // count fields, names pointing into one packed buffer
+    pub count: usize,
+    pub owner: usize,       // Released with release_schema (0 on error)
+    pub error: *mut c_char, // Error message on failure, freed with free_string
+}
+
+/// Fields plus the concatenated bytes of every column name they point into
+struct PackedSchema {
+    fields: Vec<SchemaField>,
+    _names: String,
+}
+
+fn pack(schema: &Schema) -> Box<PackedSchema> {
+    let names: String = schema.iter_names().map(|name| name.as_str()).collect();
+    let mut offset = 0;
+    let fields = schema
+        .iter()
+        .map(|(name, dtype)| {
+            let field = SchemaField {
+                name: RawStr {
+                    data: unsafe { names.as_ptr().add(offset) } as *const c_char,
+                    len: name.len(),
+                },
+                dtype: encode_data_type(dtype).unwrap_or(0), // 0 = not representable
+            };
+            offset += name.len();
+            field
+        })
+        .collect();
+    // Moving the String keeps its heap bytes in place, so the field names stay valid
+    Box::new(PackedSchema {
+        fields,
+        _names: names,
+    })
+}
+
+/// Column names and bit-packed types of a DataFrame, LazyFrame or LazyGroupBy handle
+/// Lazy handles resolve the schema from the plan (collect_schema), so no data is
+/// read; file scans only touch metadata. Grouped handles report the key columns.
+#[no_mangle]
+pub extern "C" fn dataframe_schema(handle: PolarsHandle, out: *mut SchemaBuffer) -> c_int {
+    if out.is_null() {
+        return ERROR_NULL_ARGS;
+    }
+
+    let fail = |code: c_int, message: String| {
+        unsafe {
+            *out = SchemaBuffer {
+                fields: ptr::null(),
+                count: 0,
+                owner: 0,
+                error: CString::new(message).unwrap_or_default().into_raw(),
+            }
+        };
+        code
+    };
+
+    let packed = match registry::get(handle.handle) {
+        Some(Frame::DataFrame(df)) => Ok(pack(&df.schema())),
+        Some(Frame::LazyFrame(lf)) => unwrap_or_clone(lf)
+            .collect_schema()
+            .map(|schema| pack(&schema)),
+        Some(Frame::LazyGroupBy(gb)) => unwrap_or_clone(gb)
+            .agg(Vec::<Expr>::new())
+            .collect_schema()
+            .map(|schema| pack(&schema)),
+        None => return fail(ERROR_NULL_HANDLE, "Invalid or released handle".to_string()),
+    };
+    let packed = match packed {
+        Ok(packed) => packed,
+        Err(e) => return fail(ERROR_POLARS_OPERATION, e.to_string()),
+    };
+    unsafe {
+        *out = SchemaBuffer {
+            fields: packed.fields.as_ptr(),
+            count: packed.fields.len(),
+            owner: Box::into_raw(packed) as usize,
+            error: ptr::null_mut(),
+        }
+    };
+    0
+}
+
+/// Release a schema returned by dataframe_schema
+#[no_mangle]
+pub extern "C" fn release_schema(owner: usize) {
+    if owner != 0 {
+        unsafe {
+            let _ = Box::from_raw(owner as *mut PackedSchema);
+        }
+    }
+}
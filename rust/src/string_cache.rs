@@ -0,0 +1,27 @@
+use polars::prelude::{using_string_cache, StringCacheHolder};
+
+/// Enable the global string cache until the returned token is released
+/// Categoricals created while a token is held share one string-to-index mapping,
+/// so joins, comparisons and concats across frames use the physical integers
+/// instead of hashing strings. Tokens nest: the cache is dropped (and its memory
+/// freed) once the last one is released.
+#[no_mangle]
+pub extern "C" fn string_cache_acquire() -> usize {
+    Box::into_raw(Box::new(StringCacheHolder::hold())) as usize
+}
+
+/// Release a token returned by string_cache_acquire
+#[no_mangle]
+pub extern "C" fn string_cache_release(token: usize) {
+    if token != 0 {
+        unsafe {
+            let _ = Box::from_raw(token as *mut StringCacheHolder);
+        }
+    }
+}
+
+/// Whether the global string cache is currently enabled
+#[no_mangle]
+pub extern "C" fn string_cache_enabled() -> bool {
+    using_string_cache()
+}
@@ -0,0 +1,92 @@
+use crate::registry::{self, Frame};
+use crate::{
+    RawStr, ERROR_INVALID_UTF8, ERROR_NULL_ARGS, ERROR_NULL_HANDLE, ERROR_POLARS_OPERATION,
+};
+use polars::prelude::IntoLazy;
+use polars_sql::SQLContext;
+use std::collections::BTreeMap;
+use std::os::raw::c_int;
+use std::sync::RwLock;
+
+/// Name under which Query exposes its own input frame
+const INPUT_TABLE: &str = "df";
+
+/// Named frames visible to every SQL query, shared (not copied) from their handles
+static TABLES: RwLock<BTreeMap<String, Frame>> = RwLock::new(BTreeMap::new());
+
+fn table_name(name: &RawStr) -> Result<&str, c_int> {
+    match unsafe { name.as_str() } {
+        Ok("") => Err(ERROR_NULL_ARGS),
+        Ok(name) => Ok(name),
+        Err(_) => Err(ERROR_INVALID_UTF8),
+    }
+}
+
+/// Number of registered tables
+pub(crate) fn table_count() -> usize {
+    TABLES
+        .read()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+        .len()
+}
+
+/// SQL context holding every registered table
+/// DataFrames are registered without copying their columns; LazyFrames share their
+/// plan, so a lazy table is re-scanned by every query that reads it.
+pub(crate) fn sql_context() -> SQLContext {
+    let mut ctx = SQLContext::new();
+    let tables = TABLES
+        .read()
+        .unwrap_or_else(|poisoned| poisoned.into_inner());
+    for (name, frame) in tables.iter() {
+        match frame {
+            Frame::DataFrame(df) => ctx.register(name, df.as_ref().clone().lazy()),
+            Frame::LazyFrame(lf) => ctx.register(name, lf.as_ref().clone()),
+            Frame::LazyGroupBy(_) => {} // Rejected by register_table
+        }
+    }
+    ctx
+}
+
+/// Register the frame of a handle as a named SQL table, replacing any previous one
+/// The table shares the frame, so the handle may be released afterwards.
+/// Grouped handles cannot be registered, and "df" is reserved for the query input.
+#[no_mangle]
+pub extern "C" fn register_table(name: RawStr, handle: usize) -> c_int {
+    let name = match table_name(&name) {
+        Ok(name) => name,
+        Err(code) => return code,
+    };
+    if name == INPUT_TABLE {
+        return ERROR_POLARS_OPERATION;
+    }
+
+    let frame = match registry::get(handle) {
+        Some(Frame::LazyGroupBy(_)) => return ERROR_POLARS_OPERATION,
+        Some(frame) => frame,
+        None => return ERROR_NULL_HANDLE,
+    };
+    TABLES
+        .write()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+        .insert(name.to_string(), frame);
+    0
+}
+
+/// Remove a named SQL table; ERROR_POLARS_OPERATION if it was not registered
+#[no_mangle]
+pub extern "C" fn unregister_table(name: RawStr) -> c_int {
+    let name = match table_name(&name) {
+        Ok(name) => name,
+        Err(code) => return code,
+    };
+    let removed = TABLES
+        .write()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+        .remove(name);
+    if removed.is_some() {
+        0
+    } else {
+        ERROR_POLARS_OPERATION
+    }
+}
@@ -1,4 +1,5 @@
-use crate::{FfiResult, RawStr, ERROR_POLARS_OPERATION};
+use crate::{FfiResult, RawStr, ERROR_INVALID_UTF8, ERROR_NULL_ARGS, ERROR_POLARS_OPERATION};
+use polars::export::arrow::array::Utf8ViewArray;
 use polars::prelude::*;
 
 /// Arguments for column reference operations
@@ -43,12 +44,26 @@ pub struct CastArgs {
     pub dtype: u32,          // Target data type (bit-packed encoding)
     pub strict: bool,        // If true, raise error on invalid cast; if false, produce null
     pub wrap_numerical: bool, // If true, wrap overflowing numeric values instead of marking invalid
+    pub categories: *const RawStr, // Enum categories in physical order (ENUM_DATA_TYPE only)
+    pub category_count: usize,
+}
+
+/// Arguments for parameter placeholders in prepared plans
+#[repr(C)]
+pub struct ParamArgs {
+    pub index: u32, // Parameter slot bound at execute_prepared time
+}
+
+/// Arguments for common subexpression references (ExprDup / ExprLoad)
+#[repr(C)]
+pub struct SlotArgs {
+    pub slot: u32, // Slot index, scoped to one execute_operations call
 }
 
 /// Centralized literal abstraction - C-compatible struct for various literal values
 #[repr(C)]
 pub struct Literal {
-    pub value_type: u8, // 0=int, 1=float, 2=string, 3=bool
+    pub value_type: u8, // 0=int, 1=float, 2=string, 3=bool, 4=null
     pub int_value: i64,
     pub float_value: f64,
     pub string_value: RawStr,
@@ -69,11 +84,40 @@ impl Literal {
                 }
             }
             3 => Ok(lit(self.bool_value)), // bool
+            4 => Ok(lit(Null {})),         // null (typed by the surrounding expression)
             _ => Err("Invalid literal type"),
         }
     }
 }
 
+/// A named column type used to pass schemas across FFI
+#[repr(C)]
+pub struct SchemaField {
+    pub name: RawStr, // Column name
+    pub dtype: u32,   // Bit-packed data type (see decode_data_type)
+}
+
+/// Build a Polars Schema from an array of SchemaFields
+/// # Safety
+/// `fields` must point to `count` valid SchemaFields (or be null when count is 0)
+pub unsafe fn decode_schema(fields: *const SchemaField, count: usize) -> Result<Schema, FfiResult> {
+    let mut schema = Schema::with_capacity(count);
+    if fields.is_null() || count == 0 {
+        return Ok(schema);
+    }
+
+    for field in std::slice::from_raw_parts(fields, count) {
+        let name = match field.name.as_str() {
+            Ok(s) => s,
+            Err(_) => return Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in column name")),
+        };
+        let dtype = decode_data_type(field.dtype)?;
+        schema.with_column(name.into(), dtype);
+    }
+
+    Ok(schema)
+}
+
 /// Decode bit-packed data type from u32 to Polars DataType
 pub fn decode_data_type(encoded: u32) -> Result<DataType, FfiResult> {
     // Extract type family (high 16 bits) and variant (low 16 bits)
@@ -113,6 +157,11 @@ pub fn decode_data_type(encoded: u32) -> Result<DataType, FfiResult> {
             // String family
             match variant {
                 0x0001 => Ok(DataType::String),
+                0x0002 => Ok(DataType::Categorical(None, CategoricalOrdering::Physical)),
+                0x0003 => Err(FfiResult::error(
+                    ERROR_POLARS_OPERATION,
+                    "Enum types need their categories (cast with CastEnum)",
+                )),
                 _ => Err(FfiResult::error(
                     ERROR_POLARS_OPERATION,
                     &format!("Unknown string type variant: {}", variant),
@@ -151,3 +200,61 @@ pub fn decode_data_type(encoded: u32) -> Result<DataType, FfiResult> {
         )),
     }
 }
+
+/// Bit-packed code of Enum types, whose categories are passed separately
+pub const ENUM_DATA_TYPE: u32 = 0x0002_0003;
+
+/// Build an Enum DataType from its categories, which fix the physical order
+/// # Safety
+/// `categories` must point to `count` valid RawStrs (or be null when count is 0)
+pub unsafe fn decode_enum_type(categories: *const RawStr, count: usize) -> Result<DataType, FfiResult> {
+    if categories.is_null() || count == 0 {
+        return Err(FfiResult::error(ERROR_NULL_ARGS, "Enum requires at least one category"));
+    }
+
+    let mut values = Vec::with_capacity(count);
+    let mut seen = std::collections::HashSet::with_capacity(count);
+    for category in std::slice::from_raw_parts(categories, count) {
+        let value = match category.as_str() {
+            Ok(s) => s,
+            Err(_) => return Err(FfiResult::error(ERROR_INVALID_UTF8, "Invalid UTF-8 in enum category")),
+        };
+        if !seen.insert(value) {
+            return Err(FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                &format!("Duplicate enum category: {}", value),
+            ));
+        }
+        values.push(value);
+    }
+
+    Ok(create_enum_dtype(Utf8ViewArray::from_slice_values(&values)))
+}
+
+/// Encode a Polars DataType with the bit-packed scheme of decode_data_type
+/// Returns None for types the encoding does not cover (lists, structs, decimals...).
+pub fn encode_data_type(dtype: &DataType) -> Option<u32> {
+    let encoded = match dtype {
+        DataType::Int8 => 0x0000_0001,
+        DataType::Int16 => 0x0000_0002,
+        DataType::Int32 => 0x0000_0003,
+        DataType::Int64 => 0x0000_0004,
+        DataType::UInt8 => 0x0000_0005,
+        DataType::UInt16 => 0x0000_0006,
+        DataType::UInt32 => 0x0000_0007,
+        DataType::UInt64 => 0x0000_0008,
+        DataType::Float32 => 0x0001_0001,
+        DataType::Float64 => 0x0001_0002,
+        DataType::String => 0x0002_0001,
+        DataType::Categorical(_, _) => 0x0002_0002,
+        DataType::Enum(_, _) => ENUM_DATA_TYPE,
+        DataType::Date => 0x0003_0001,
+        DataType::Time => 0x0003_0002,
+        DataType::Datetime(TimeUnit::Nanoseconds, _) => 0x0003_0003,
+        DataType::Datetime(TimeUnit::Microseconds, _) => 0x0003_0004,
+        DataType::Datetime(TimeUnit::Milliseconds, _) => 0x0003_0005,
+        DataType::Boolean => 0x0004_0001,
+        _ => return None,
+    };
+    Some(encoded)
+}
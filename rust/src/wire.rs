@@ -0,0 +1,905 @@
+use crate::{
+    execute_operations, AggregationArgs, AliasArgs, AsofArgs, AsofStrategy, CastArgs, CollectArgs,
+    ColumnArgs, ConcatArgs, ConcatMode, CountArgs, EwmArgs, FfiResult, FilterExprArgs, GroupByArgs,
+    GroupByDynamicArgs, JoinArgs, JoinType, JoinValidation, LimitArgs, Literal, LiteralArgs,
+    NullsOrdering, OpCode, Operation, ParamArgs, PolarsHandle, QueryArgs, RawStr, ReadCsvArgs,
+    ReadParquetArgs, RollingArgs, RollingExprArgs, SchemaField, SelectArgs, SinkCompression,
+    SinkCsvArgs, SinkIpcArgs, SinkParquetArgs, SlotArgs, SortArgs, SortDirection, SortField,
+    SqlExprArgs, StringArgs, WindowArgs, WindowClosed, WindowLabel, WindowOffsetArgs,
+    ERROR_NULL_ARGS, ERROR_POLARS_OPERATION,
+};
+use std::any::Any;
+use std::os::raw::{c_char, c_int};
+use std::ptr;
+
+// Packed wire format for operation chains
+//
+//   program := magic "FIRN" version:u op*
+//   op      := opcode:u length:u payload[length]
+//
+// Payloads hold the op's args fields in declaration order: u = unsigned LEB128 varint,
+// i = zigzag varint, b = one byte 0/1, f = 8 bytes little-endian, s = u length + UTF-8
+// bytes, list = u count + items. An empty payload stands for null args (Collect and
+// GroupBy only). FilterExpr's payload is a nested op* stream. Handles (Join, Concat)
+// are process-local values.
+//
+// The version changes whenever a payload layout or value range changes; version 2
+// added the ExprCast categories and the Concat mode/parallel fields, and dropped
+// the Collect chunk size and memory budget.
+
+const MAGIC: &[u8; 4] = b"FIRN";
+const VERSION: u64 = 2;
+
+/// Owns the args structs decoded from a program while its op chain runs
+/// Strings are not copied: RawStrs point into the encoded buffer.
+#[derive(Default)]
+struct DecodedArgs {
+    owned: Vec<Box<dyn Any>>,
+    ops: usize, // Ops decoded so far, nested streams included
+}
+
+impl DecodedArgs {
+    fn keep<T: 'static>(&mut self, value: T) -> usize {
+        let boxed = Box::new(value);
+        let ptr = &*boxed as *const T as usize;
+        self.owned.push(boxed);
+        ptr
+    }
+
+    /// Keeps an array and returns its address (null when empty, as the Go builders pass)
+    fn keep_slice<T: 'static>(&mut self, items: Vec<T>) -> *const T {
+        if items.is_empty() {
+            return ptr::null();
+        }
+        let items = items.into_boxed_slice();
+        let ptr = items.as_ptr();
+        self.owned.push(Box::new(items));
+        ptr
+    }
+}
+
+/// Sequential reader over one payload (or the whole program)
+struct Reader<'a> {
+    buf: &'a [u8],
+    pos: usize,
+}
+
+type DecodeResult<T> = std::result::Result<T, String>;
+
+impl<'a> Reader<'a> {
+    fn new(buf: &'a [u8]) -> Self {
+        Reader { buf, pos: 0 }
+    }
+
+    fn done(&self) -> bool {
+        self.pos == self.buf.len()
+    }
+
+    fn bytes(&mut self, len: usize) -> DecodeResult<&'a [u8]> {
+        if self.buf.len() - self.pos < len {
+            return Err("unexpected end of program".to_string());
+        }
+        let bytes = &self.buf[self.pos..self.pos + len];
+        self.pos += len;
+        Ok(bytes)
+    }
+
+    fn uvarint(&mut self) -> DecodeResult<u64> {
+        let mut value = 0u64;
+        for shift in (0..64).step_by(7) {
+            let byte = self.bytes(1)?[0];
+            value |= u64::from(byte & 0x7f) << shift;
+            if byte & 0x80 == 0 {
+                return Ok(value);
+            }
+        }
+        Err("varint overflows 64 bits".to_string())
+    }
+
+    fn ivarint(&mut self) -> DecodeResult<i64> {
+        let value = self.uvarint()?;
+        Ok((value >> 1) as i64 ^ -((value & 1) as i64))
+    }
+
+    fn uint<T: TryFrom<u64>>(&mut self) -> DecodeResult<T> {
+        let value = self.uvarint()?;
+        T::try_from(value).map_err(|_| format!("value {} out of range", value))
+    }
+
+    fn int<T: TryFrom<i64>>(&mut self) -> DecodeResult<T> {
+        let value = self.ivarint()?;
+        T::try_from(value).map_err(|_| format!("value {} out of range", value))
+    }
+
+    fn bool(&mut self) -> DecodeResult<bool> {
+        match self.bytes(1)?[0] {
+            0 => Ok(false),
+            1 => Ok(true),
+            byte => Err(format!("invalid bool {}", byte)),
+        }
+    }
+
+    fn f64(&mut self) -> DecodeResult<f64> {
+        let bytes = self.bytes(8)?;
+        Ok(f64::from_le_bytes(bytes.try_into().unwrap()))
+    }
+
+    fn str(&mut self) -> DecodeResult<RawStr> {
+        let len = self.uint::<usize>()?;
+        let bytes = self.bytes(len)?;
+        Ok(RawStr {
+            data: bytes.as_ptr() as *const c_char,
+            len,
+        })
+    }
+
+    /// Reads a list count; every item takes at least one byte, which bounds allocations
+    fn count(&mut self) -> DecodeResult<usize> {
+        let count = self.uint::<usize>()?;
+        if count > self.buf.len() - self.pos {
+            return Err(format!("list of {} items exceeds the program", count));
+        }
+        Ok(count)
+    }
+
+    fn list<T>(
+        &mut self,
+        mut item: impl FnMut(&mut Self) -> DecodeResult<T>,
+    ) -> DecodeResult<Vec<T>> {
+        let count = self.count()?;
+        (0..count).map(|_| item(self)).collect()
+    }
+
+    fn strs(&mut self) -> DecodeResult<Vec<RawStr>> {
+        self.list(Self::str)
+    }
+}
+
+// Enum fields are validated before they become #[repr(C)] enums
+
+fn window_closed(value: u32) -> DecodeResult<WindowClosed> {
+    Ok(match value {
+        0 => WindowClosed::Default,
+        1 => WindowClosed::Left,
+        2 => WindowClosed::Right,
+        3 => WindowClosed::Both,
+        4 => WindowClosed::None,
+        _ => return Err(format!("invalid window closed {}", value)),
+    })
+}
+
+fn window_label(value: u32) -> DecodeResult<WindowLabel> {
+    Ok(match value {
+        0 => WindowLabel::Left,
+        1 => WindowLabel::Right,
+        2 => WindowLabel::DataPoint,
+        _ => return Err(format!("invalid window label {}", value)),
+    })
+}
+
+fn sink_compression(value: u32) -> DecodeResult<SinkCompression> {
+    Ok(match value {
+        0 => SinkCompression::Uncompressed,
+        1 => SinkCompression::Snappy,
+        2 => SinkCompression::Gzip,
+        3 => SinkCompression::Lz4,
+        4 => SinkCompression::Zstd,
+        5 => SinkCompression::Brotli,
+        _ => return Err(format!("invalid compression {}", value)),
+    })
+}
+
+fn join_type(value: u32) -> DecodeResult<JoinType> {
+    Ok(match value {
+        0 => JoinType::Inner,
+        1 => JoinType::Left,
+        2 => JoinType::Right,
+        3 => JoinType::Outer,
+        4 => JoinType::Cross,
+        5 => JoinType::Semi,
+        6 => JoinType::Anti,
+        7 => JoinType::AsOf,
+        _ => return Err(format!("invalid join type {}", value)),
+    })
+}
+
+fn concat_mode(value: u32) -> DecodeResult<ConcatMode> {
+    Ok(match value {
+        0 => ConcatMode::Vertical,
+        1 => ConcatMode::VerticalRelaxed,
+        2 => ConcatMode::Diagonal,
+        3 => ConcatMode::DiagonalRelaxed,
+        _ => return Err(format!("invalid concat mode {}", value)),
+    })
+}
+
+fn join_validation(value: u32) -> DecodeResult<JoinValidation> {
+    Ok(match value {
+        0 => JoinValidation::ManyToMany,
+        1 => JoinValidation::ManyToOne,
+        2 => JoinValidation::OneToMany,
+        3 => JoinValidation::OneToOne,
+        _ => return Err(format!("invalid join validation {}", value)),
+    })
+}
+
+fn asof_strategy(value: u32) -> DecodeResult<AsofStrategy> {
+    Ok(match value {
+        0 => AsofStrategy::Backward,
+        1 => AsofStrategy::Forward,
+        2 => AsofStrategy::Nearest,
+        _ => return Err(format!("invalid asof strategy {}", value)),
+    })
+}
+
+fn schema_field(r: &mut Reader) -> DecodeResult<SchemaField> {
+    Ok(SchemaField {
+        name: r.str()?,
+        dtype: r.uint()?,
+    })
+}
+
+fn sort_field(r: &mut Reader) -> DecodeResult<SortField> {
+    let column = r.str()?;
+    let direction = SortDirection::from_u32(r.uint()?).ok_or("invalid sort direction")?;
+    let nulls_ordering = NullsOrdering::from_u32(r.uint()?).ok_or("invalid nulls ordering")?;
+    Ok(SortField {
+        column,
+        direction,
+        nulls_ordering,
+    })
+}
+
+fn literal(r: &mut Reader) -> DecodeResult<Literal> {
+    let mut literal = Literal {
+        value_type: r.uint()?,
+        int_value: 0,
+        float_value: 0.0,
+        string_value: RawStr {
+            data: ptr::null(),
+            len: 0,
+        },
+        bool_value: false,
+    };
+    match literal.value_type {
+        0 => literal.int_value = r.ivarint()?,
+        1 => literal.float_value = r.f64()?,
+        2 => literal.string_value = r.str()?,
+        3 => literal.bool_value = r.bool()?,
+        4 => {} // Null carries no value
+        other => return Err(format!("invalid literal type {}", other)),
+    }
+    Ok(literal)
+}
+
+/// Decodes one op's payload into its args struct (0 for ops without args)
+/// Only Collect and GroupBy accept null args; every other handler reads its struct.
+fn decode_args(opcode: OpCode, r: &mut Reader, args: &mut DecodedArgs) -> DecodeResult<usize> {
+    if r.done() && matches!(opcode, OpCode::Collect | OpCode::GroupBy) {
+        return Ok(0); // Null args select the defaults
+    }
+
+    let ptr = match opcode {
+        OpCode::ReadCsv => {
+            let path = r.str()?;
+            let has_header = r.bool()?;
+            let with_glob = r.bool()?;
+            let schema = r.list(schema_field)?;
+            let overrides = r.list(schema_field)?;
+            let csv = ReadCsvArgs {
+                path,
+                has_header,
+                with_glob,
+                schema_count: schema.len(),
+                schema: args.keep_slice(schema),
+                dtype_override_count: overrides.len(),
+                dtype_overrides: args.keep_slice(overrides),
+                infer_schema_length: r.ivarint()?,
+                separator: r.uint()?,
+                quote_char: r.uint()?,
+                disable_quoting: r.bool()?,
+                n_rows: r.uint()?,
+                skip_rows: r.uint()?,
+                low_memory: r.bool()?,
+                rechunk: r.bool()?,
+                chunk_size: r.uint()?,
+            };
+            args.keep(csv)
+        }
+        OpCode::ReadParquet => {
+            let path = r.str()?;
+            let columns = r.strs()?;
+            let parquet = ReadParquetArgs {
+                path,
+                column_count: columns.len(),
+                columns: args.keep_slice(columns),
+                n_rows: r.uint()?,
+                parallel: r.bool()?,
+                with_glob: r.bool()?,
+                use_statistics: r.bool()?,
+                hive_partitioning: r.uint()?,
+                try_parse_hive_dates: r.bool()?,
+                low_memory: r.bool()?,
+                cache: r.bool()?,
+                rechunk: r.bool()?,
+                row_index_name: r.str()?,
+                row_index_offset: r.uint()?,
+            };
+            args.keep(parquet)
+        }
+        OpCode::Select => {
+            let columns = r.strs()?;
+            let select = SelectArgs {
+                column_count: columns.len(),
+                columns: args.keep_slice(columns),
+            };
+            args.keep(select)
+        }
+        OpCode::Concat => {
+            let handles = r.list(|r| r.uint::<usize>())?;
+            let concat = ConcatArgs {
+                count: handles.len(),
+                handles: args.keep_slice(handles),
+                how: concat_mode(r.uint()?)?,
+                parallel: r.bool()?,
+            };
+            args.keep(concat)
+        }
+        OpCode::FilterExpr => {
+            let ops = decode_ops(r, args).map_err(|(_, message)| message)?;
+            let filter = FilterExprArgs {
+                expr_count: ops.len(),
+                expr_ops: args.keep_slice(ops),
+            };
+            args.keep(filter)
+        }
+        OpCode::GroupBy => args.keep(GroupByArgs {
+            maintain_order: r.bool()?,
+        }),
+        OpCode::GroupByDynamic => args.keep(GroupByDynamicArgs {
+            index_column: r.str()?,
+            every: r.str()?,
+            period: r.str()?,
+            offset: r.str()?,
+            closed: window_closed(r.uint()?)?,
+            label: window_label(r.uint()?)?,
+            include_boundaries: r.bool()?,
+        }),
+        OpCode::Rolling => args.keep(RollingArgs {
+            index_column: r.str()?,
+            period: r.str()?,
+            offset: r.str()?,
+            closed: window_closed(r.uint()?)?,
+        }),
+        OpCode::Sort => {
+            let fields = r.list(sort_field)?;
+            let sort = SortArgs {
+                field_count: c_int::try_from(fields.len()).map_err(|_| "too many sort fields")?,
+                fields: args.keep_slice(fields),
+            };
+            args.keep(sort)
+        }
+        OpCode::Limit => args.keep(LimitArgs { n: r.uint()? }),
+        OpCode::Query => args.keep(QueryArgs { sql: r.str()? }),
+        OpCode::Join => {
+            let other_handle = r.uint()?;
+            let left_on = r.strs()?;
+            let right_on = r.strs()?;
+            if left_on.len() != right_on.len() {
+                return Err("join key lists differ in length".to_string());
+            }
+            let column_count = left_on.len();
+            let left_on = args.keep_slice(left_on);
+            let right_on = args.keep_slice(right_on);
+            let how = join_type(r.uint()?)?;
+            let suffix = r.str()?;
+            let coalesce = r.bool()?;
+            let validation = join_validation(r.uint()?)?;
+            let sorted_keys = r.bool()?;
+            let asof = if r.bool()? {
+                let strategy = asof_strategy(r.uint()?)?;
+                let tolerance = r.str()?;
+                let by = r.strs()?;
+                let asof = AsofArgs {
+                    strategy,
+                    tolerance,
+                    by_count: by.len(),
+                    by: args.keep_slice(by),
+                };
+                args.keep(asof) as *const AsofArgs
+            } else {
+                ptr::null()
+            };
+            args.keep(JoinArgs {
+                other_handle,
+                left_on,
+                right_on,
+                column_count,
+                how,
+                suffix,
+                coalesce,
+                validation,
+                sorted_keys,
+                asof,
+            })
+        }
+        OpCode::Collect => args.keep(CollectArgs {
+            streaming: r.bool()?,
+            disable_predicate_pushdown: r.bool()?,
+            disable_projection_pushdown: r.bool()?,
+            disable_slice_pushdown: r.bool()?,
+            disable_cse: r.bool()?,
+        }),
+        OpCode::SinkParquet => args.keep(SinkParquetArgs {
+            path: r.str()?,
+            compression: sink_compression(r.uint()?)?,
+            compression_level: r.int()?,
+            row_group_size: r.uint()?,
+            data_page_size: r.uint()?,
+            statistics: r.bool()?,
+            maintain_order: r.bool()?,
+        }),
+        OpCode::SinkCsv => args.keep(SinkCsvArgs {
+            path: r.str()?,
+            include_header: r.bool()?,
+            separator: r.uint()?,
+            batch_size: r.uint()?,
+            maintain_order: r.bool()?,
+        }),
+        OpCode::SinkIpc => args.keep(SinkIpcArgs {
+            path: r.str()?,
+            compression: sink_compression(r.uint()?)?,
+            maintain_order: r.bool()?,
+        }),
+        OpCode::ExprColumn => args.keep(ColumnArgs { name: r.str()? }),
+        OpCode::ExprLiteral => args.keep(LiteralArgs {
+            literal: literal(r)?,
+        }),
+        OpCode::ExprAlias => args.keep(AliasArgs { name: r.str()? }),
+        OpCode::ExprStrContains | OpCode::ExprStrStartsWith | OpCode::ExprStrEndsWith => {
+            args.keep(StringArgs { pattern: r.str()? })
+        }
+        OpCode::ExprSql => args.keep(SqlExprArgs { sql: r.str()? }),
+        OpCode::ExprStd | OpCode::ExprVar => args.keep(AggregationArgs { ddof: r.uint()? }),
+        OpCode::ExprCount | OpCode::ExprCountNulls => args.keep(CountArgs {
+            include_nulls: r.bool()?,
+        }),
+        OpCode::ExprOver => {
+            let partition = r.strs()?;
+            let order = r.strs()?;
+            let window = WindowArgs {
+                partition_count: c_int::try_from(partition.len())
+                    .map_err(|_| "too many columns")?,
+                partition_columns: args.keep_slice(partition),
+                order_count: c_int::try_from(order.len()).map_err(|_| "too many columns")?,
+                order_columns: args.keep_slice(order),
+            };
+            args.keep(window)
+        }
+        OpCode::ExprLag | OpCode::ExprLead => args.keep(WindowOffsetArgs { offset: r.int()? }),
+        OpCode::ExprCast => {
+            let dtype = r.uint()?;
+            let strict = r.bool()?;
+            let wrap_numerical = r.bool()?;
+            let categories = r.strs()?;
+            let cast = CastArgs {
+                dtype,
+                strict,
+                wrap_numerical,
+                category_count: categories.len(),
+                categories: args.keep_slice(categories),
+            };
+            args.keep(cast)
+        }
+        OpCode::ExprRollingSum
+        | OpCode::ExprRollingMean
+        | OpCode::ExprRollingMin
+        | OpCode::ExprRollingMax
+        | OpCode::ExprRollingStd => args.keep(RollingExprArgs {
+            window_size: r.uint()?,
+            min_periods: r.uint()?,
+            center: r.bool()?,
+            ddof: r.uint()?,
+            by: r.str()?,
+            duration: r.str()?,
+            closed: window_closed(r.uint()?)?,
+        }),
+        OpCode::ExprEwmMean | OpCode::ExprEwmStd => args.keep(EwmArgs {
+            alpha: r.f64()?,
+            adjust: r.bool()?,
+            bias: r.bool()?,
+            min_periods: r.uint()?,
+            ignore_nulls: r.bool()?,
+        }),
+        OpCode::ExprParam => args.keep(ParamArgs { index: r.uint()? }),
+        OpCode::ExprDup | OpCode::ExprLoad => {
+            // Slots are numbered in order of their first ExprDup, which follows the
+            // subexpression it saves, so a valid slot is below the ops decoded before
+            let slot: u32 = r.uint()?;
+            if slot as usize >= args.ops {
+                return Err(format!("subexpression slot {} out of range", slot));
+            }
+            args.keep(SlotArgs { slot })
+        }
+        _ if r.done() => return Ok(0), // Ops without args
+        _ => return Err(format!("{:?} takes no args", opcode)),
+    };
+
+    if !r.done() {
+        return Err("trailing bytes after op args".to_string());
+    }
+    Ok(ptr)
+}
+
+/// Decodes one op and its payload
+fn decode_op(r: &mut Reader, args: &mut DecodedArgs) -> DecodeResult<Operation> {
+    let opcode: u32 = r.uint()?;
+    let code = OpCode::from_u32(opcode).ok_or_else(|| format!("Invalid opcode: {}", opcode))?;
+    if code == OpCode::ImportArrow {
+        return Err("ImportArrow cannot be decoded from a program".to_string());
+    }
+    let len = r.uint()?;
+    let mut payload = Reader::new(r.bytes(len)?);
+    let op = Operation {
+        opcode,
+        args: decode_args(code, &mut payload, args)?,
+    };
+    args.ops += 1;
+    Ok(op)
+}
+
+/// Decodes an op* stream until the reader is exhausted
+/// Errors carry the index of the failing op.
+fn decode_ops(
+    r: &mut Reader,
+    args: &mut DecodedArgs,
+) -> std::result::Result<Vec<Operation>, (usize, String)> {
+    let mut ops = Vec::new();
+    while !r.done() {
+        let op = decode_op(r, args).map_err(|message| (ops.len(), message))?;
+        ops.push(op);
+    }
+    Ok(ops)
+}
+
+/// Sequential writer producing the same payloads the Go encoder does
+#[derive(Default)]
+struct Writer {
+    buf: Vec<u8>,
+}
+
+/// View an args array, empty when the pointer is null
+unsafe fn items<'a, T>(ptr: *const T, count: usize) -> &'a [T] {
+    if ptr.is_null() || count == 0 {
+        &[]
+    } else {
+        std::slice::from_raw_parts(ptr, count)
+    }
+}
+
+impl Writer {
+    fn uint(&mut self, mut value: u64) {
+        while value >= 0x80 {
+            self.buf.push(value as u8 | 0x80);
+            value >>= 7;
+        }
+        self.buf.push(value as u8);
+    }
+
+    fn int(&mut self, value: i64) {
+        self.uint(((value << 1) ^ (value >> 63)) as u64);
+    }
+
+    fn bool(&mut self, value: bool) {
+        self.buf.push(value as u8);
+    }
+
+    fn f64(&mut self, value: f64) {
+        self.buf.extend_from_slice(&value.to_le_bytes());
+    }
+
+    unsafe fn str(&mut self, value: &RawStr) {
+        let bytes = items(value.data as *const u8, value.len);
+        self.uint(bytes.len() as u64);
+        self.buf.extend_from_slice(bytes);
+    }
+
+    unsafe fn strs(&mut self, values: *const RawStr, count: usize) {
+        let values = items(values, count);
+        self.uint(values.len() as u64);
+        for value in values {
+            self.str(value);
+        }
+    }
+
+    unsafe fn schema(&mut self, fields: *const SchemaField, count: usize) {
+        let fields = items(fields, count);
+        self.uint(fields.len() as u64);
+        for field in fields {
+            self.str(&field.name);
+            self.uint(field.dtype.into());
+        }
+    }
+}
+
+/// Encodes one op's args struct into its payload, the inverse of decode_args
+/// Null args and ops without args encode as an empty payload.
+unsafe fn encode_args(opcode: OpCode, args: usize, w: &mut Writer) -> DecodeResult<()> {
+    if args == 0 {
+        return Ok(());
+    }
+
+    match opcode {
+        OpCode::ReadCsv => {
+            let csv = &*(args as *const ReadCsvArgs);
+            w.str(&csv.path);
+            w.bool(csv.has_header);
+            w.bool(csv.with_glob);
+            w.schema(csv.schema, csv.schema_count);
+            w.schema(csv.dtype_overrides, csv.dtype_override_count);
+            w.int(csv.infer_schema_length);
+            w.uint(csv.separator.into());
+            w.uint(csv.quote_char.into());
+            w.bool(csv.disable_quoting);
+            w.uint(csv.n_rows as u64);
+            w.uint(csv.skip_rows as u64);
+            w.bool(csv.low_memory);
+            w.bool(csv.rechunk);
+            w.uint(csv.chunk_size as u64);
+        }
+        OpCode::ReadParquet => {
+            let parquet = &*(args as *const ReadParquetArgs);
+            w.str(&parquet.path);
+            w.strs(parquet.columns, parquet.column_count);
+            w.uint(parquet.n_rows as u64);
+            w.bool(parquet.parallel);
+            w.bool(parquet.with_glob);
+            w.bool(parquet.use_statistics);
+            w.uint(parquet.hive_partitioning.into());
+            w.bool(parquet.try_parse_hive_dates);
+            w.bool(parquet.low_memory);
+            w.bool(parquet.cache);
+            w.bool(parquet.rechunk);
+            w.str(&parquet.row_index_name);
+            w.uint(parquet.row_index_offset.into());
+        }
+        OpCode::Select => {
+            let select = &*(args as *const SelectArgs);
+            w.strs(select.columns, select.column_count);
+        }
+        OpCode::Concat => {
+            let concat = &*(args as *const ConcatArgs);
+            let handles = items(concat.handles, concat.count);
+            w.uint(handles.len() as u64);
+            for &handle in handles {
+                w.uint(handle as u64);
+            }
+            w.uint(concat.how as u64);
+            w.bool(concat.parallel);
+        }
+        OpCode::FilterExpr => {
+            let filter = &*(args as *const FilterExprArgs);
+            for op in items(filter.expr_ops, filter.expr_count) {
+                encode_op(op, w)?;
+            }
+        }
+        OpCode::GroupBy => w.bool((*(args as *const GroupByArgs)).maintain_order),
+        OpCode::GroupByDynamic => {
+            let group_by = &*(args as *const GroupByDynamicArgs);
+            w.str(&group_by.index_column);
+            w.str(&group_by.every);
+            w.str(&group_by.period);
+            w.str(&group_by.offset);
+            w.uint(group_by.closed as u64);
+            w.uint(group_by.label as u64);
+            w.bool(group_by.include_boundaries);
+        }
+        OpCode::Rolling => {
+            let rolling = &*(args as *const RollingArgs);
+            w.str(&rolling.index_column);
+            w.str(&rolling.period);
+            w.str(&rolling.offset);
+            w.uint(rolling.closed as u64);
+        }
+        OpCode::Sort => {
+            let sort = &*(args as *const SortArgs);
+            let fields = items(sort.fields, usize::try_from(sort.field_count).unwrap_or(0));
+            w.uint(fields.len() as u64);
+            for field in fields {
+                w.str(&field.column);
+                w.uint(field.direction as u64);
+                w.uint(field.nulls_ordering as u64);
+            }
+        }
+        OpCode::Limit => w.uint((*(args as *const LimitArgs)).n as u64),
+        OpCode::Query => w.str(&(*(args as *const QueryArgs)).sql),
+        OpCode::Join => {
+            let join = &*(args as *const JoinArgs);
+            w.uint(join.other_handle as u64);
+            w.strs(join.left_on, join.column_count);
+            w.strs(join.right_on, join.column_count);
+            w.uint(join.how as u64);
+            w.str(&join.suffix);
+            w.bool(join.coalesce);
+            w.uint(join.validation as u64);
+            w.bool(join.sorted_keys);
+            w.bool(!join.asof.is_null());
+            if let Some(asof) = join.asof.as_ref() {
+                w.uint(asof.strategy as u64);
+                w.str(&asof.tolerance);
+                w.strs(asof.by, asof.by_count);
+            }
+        }
+        OpCode::Collect => {
+            let collect = &*(args as *const CollectArgs);
+            w.bool(collect.streaming);
+            w.bool(collect.disable_predicate_pushdown);
+            w.bool(collect.disable_projection_pushdown);
+            w.bool(collect.disable_slice_pushdown);
+            w.bool(collect.disable_cse);
+        }
+        OpCode::SinkParquet => {
+            let sink = &*(args as *const SinkParquetArgs);
+            w.str(&sink.path);
+            w.uint(sink.compression as u64);
+            w.int(sink.compression_level.into());
+            w.uint(sink.row_group_size as u64);
+            w.uint(sink.data_page_size as u64);
+            w.bool(sink.statistics);
+            w.bool(sink.maintain_order);
+        }
+        OpCode::SinkCsv => {
+            let sink = &*(args as *const SinkCsvArgs);
+            w.str(&sink.path);
+            w.bool(sink.include_header);
+            w.uint(sink.separator.into());
+            w.uint(sink.batch_size as u64);
+            w.bool(sink.maintain_order);
+        }
+        OpCode::SinkIpc => {
+            let sink = &*(args as *const SinkIpcArgs);
+            w.str(&sink.path);
+            w.uint(sink.compression as u64);
+            w.bool(sink.maintain_order);
+        }
+        OpCode::ExprColumn => w.str(&(*(args as *const ColumnArgs)).name),
+        OpCode::ExprLiteral => {
+            let literal = &(*(args as *const LiteralArgs)).literal;
+            w.uint(literal.value_type.into());
+            match literal.value_type {
+                0 => w.int(literal.int_value),
+                1 => w.f64(literal.float_value),
+                2 => w.str(&literal.string_value),
+                3 => w.bool(literal.bool_value),
+                4 => {}
+                other => return Err(format!("invalid literal type {}", other)),
+            }
+        }
+        OpCode::ExprAlias => w.str(&(*(args as *const AliasArgs)).name),
+        OpCode::ExprStrContains | OpCode::ExprStrStartsWith | OpCode::ExprStrEndsWith => {
+            w.str(&(*(args as *const StringArgs)).pattern)
+        }
+        OpCode::ExprSql => w.str(&(*(args as *const SqlExprArgs)).sql),
+        OpCode::ExprStd | OpCode::ExprVar => {
+            w.uint((*(args as *const AggregationArgs)).ddof.into())
+        }
+        OpCode::ExprCount | OpCode::ExprCountNulls => {
+            w.bool((*(args as *const CountArgs)).include_nulls)
+        }
+        OpCode::ExprOver => {
+            let window = &*(args as *const WindowArgs);
+            let partition_count = usize::try_from(window.partition_count).unwrap_or(0);
+            let order_count = usize::try_from(window.order_count).unwrap_or(0);
+            w.strs(window.partition_columns, partition_count);
+            w.strs(window.order_columns, order_count);
+        }
+        OpCode::ExprLag | OpCode::ExprLead => {
+            w.int((*(args as *const WindowOffsetArgs)).offset.into())
+        }
+        OpCode::ExprCast => {
+            let cast = &*(args as *const CastArgs);
+            w.uint(cast.dtype.into());
+            w.bool(cast.strict);
+            w.bool(cast.wrap_numerical);
+            w.strs(cast.categories, cast.category_count);
+        }
+        OpCode::ExprRollingSum
+        | OpCode::ExprRollingMean
+        | OpCode::ExprRollingMin
+        | OpCode::ExprRollingMax
+        | OpCode::ExprRollingStd => {
+            let rolling = &*(args as *const RollingExprArgs);
+            w.uint(rolling.window_size as u64);
+            w.uint(rolling.min_periods as u64);
+            w.bool(rolling.center);
+            w.uint(rolling.ddof.into());
+            w.str(&rolling.by);
+            w.str(&rolling.duration);
+            w.uint(rolling.closed as u64);
+        }
+        OpCode::ExprEwmMean | OpCode::ExprEwmStd => {
+            let ewm = &*(args as *const EwmArgs);
+            w.f64(ewm.alpha);
+            w.bool(ewm.adjust);
+            w.bool(ewm.bias);
+            w.uint(ewm.min_periods as u64);
+            w.bool(ewm.ignore_nulls);
+        }
+        OpCode::ExprParam => w.uint((*(args as *const ParamArgs)).index.into()),
+        OpCode::ExprDup | OpCode::ExprLoad => w.uint((*(args as *const SlotArgs)).slot.into()),
+        _ => {} // Ops without args
+    }
+    Ok(())
+}
+
+/// Encodes one op and its payload, the inverse of decode_op
+unsafe fn encode_op(op: &Operation, w: &mut Writer) -> DecodeResult<()> {
+    let code =
+        OpCode::from_u32(op.opcode).ok_or_else(|| format!("Invalid opcode: {}", op.opcode))?;
+    if code == OpCode::ImportArrow {
+        return Err("ImportArrow references foreign memory".to_string());
+    }
+    let mut payload = Writer::default();
+    encode_args(code, op.args, &mut payload)?;
+    w.uint(op.opcode.into());
+    w.uint(payload.buf.len() as u64);
+    w.buf.extend_from_slice(&payload.buf);
+    Ok(())
+}
+
+/// Append the wire encoding of op to out, e.g. to build a result cache key
+/// Fails for ops that cannot be encoded (ImportArrow), leaving out partially written.
+pub(crate) fn append_encoded(op: &Operation, out: &mut Vec<u8>) -> DecodeResult<()> {
+    let mut w = Writer {
+        buf: std::mem::take(out),
+    };
+    let result = unsafe { encode_op(op, &mut w) };
+    *out = w.buf;
+    result
+}
+
+/// Execute an operation chain from the packed wire format
+/// The program is decoded in one linear pass into the same args structs the Go
+/// builders produce, then run like execute_operations. Strings are borrowed from
+/// the buffer, which must stay valid for the duration of the call.
+#[no_mangle]
+pub extern "C" fn execute_encoded(
+    polars_handle: PolarsHandle,
+    data: *const u8,
+    len: usize,
+) -> FfiResult {
+    if data.is_null() || len == 0 {
+        return FfiResult::error(ERROR_NULL_ARGS, "Program cannot be null or empty");
+    }
+
+    let mut reader = Reader::new(unsafe { std::slice::from_raw_parts(data, len) });
+    match reader.bytes(MAGIC.len()) {
+        Ok(magic) if magic == MAGIC => {}
+        _ => return FfiResult::error(ERROR_POLARS_OPERATION, "Not an encoded firn program"),
+    }
+    match reader.uvarint() {
+        Ok(VERSION) => {}
+        Ok(version) => {
+            return FfiResult::error(
+                ERROR_POLARS_OPERATION,
+                &format!("Unsupported program version {}", version),
+            )
+        }
+        Err(message) => return FfiResult::error(ERROR_POLARS_OPERATION, &message),
+    }
+
+    let mut args = DecodedArgs::default();
+    let ops = match decode_ops(&mut reader, &mut args) {
+        Ok(ops) => ops,
+        Err((frame, message)) => {
+            return FfiResult {
+                error_frame: frame,
+                ..FfiResult::error(
+                    ERROR_POLARS_OPERATION,
+                    &format!("Invalid program at op {}: {}", frame, message),
+                )
+            }
+        }
+    };
+    execute_operations(polars_handle, ops.as_ptr(), ops.len())
+}
@@ -102,6 +102,19 @@ fn test_read_csv_args() {
         path: raw_str,
         has_header: true,
         with_glob: false,
+        schema: std::ptr::null(),
+        schema_count: 0,
+        dtype_overrides: std::ptr::null(),
+        dtype_override_count: 0,
+        infer_schema_length: 0,
+        separator: 0,
+        quote_char: 0,
+        disable_quoting: false,
+        n_rows: 0,
+        skip_rows: 0,
+        low_memory: false,
+        rechunk: false,
+        chunk_size: 0,
     };
 
     // Verify we can read the path
@@ -1,6 +1,7 @@
 use firn::{
-    dispatch_read_parquet, ExecutionContext, ReadParquetArgs, RawStr, FfiResult,
-    PolarsHandle, ContextType, ERROR_POLARS_OPERATION,
+    dataframe_height, dispatch_collect, dispatch_read_parquet, release_dataframe,
+    ExecutionContext, ReadParquetArgs, RawStr, FfiResult, PolarsHandle, ContextType,
+    ERROR_POLARS_OPERATION,
 };
 use std::ffi::CString;
 use std::ptr;
@@ -44,6 +45,14 @@ fn test_parquet_basic_read() {
         n_rows: 5, // Limit to 5 rows for testing
         parallel: true,
         with_glob: false,
+        use_statistics: true,
+        hive_partitioning: 0,
+        try_parse_hive_dates: true,
+        low_memory: false,
+        cache: true,
+        rechunk: false,
+        row_index_name: RawStr { data: ptr::null(), len: 0 },
+        row_index_offset: 0,
     };
     
     let context = ExecutionContext {
@@ -59,11 +68,7 @@ fn test_parquet_basic_read() {
     assert_ne!(result.polars_handle.handle, 0);
     
     // Clean up
-    if result.polars_handle.handle != 0 {
-        unsafe {
-            let _ = Box::from_raw(result.polars_handle.handle as *mut polars::prelude::DataFrame);
-        }
-    }
+    assert_eq!(release_dataframe(result.polars_handle.handle), 0);
 }
 
 #[test]
@@ -80,6 +85,14 @@ fn test_parquet_column_selection() {
         n_rows: 3,
         parallel: true,
         with_glob: false,
+        use_statistics: true,
+        hive_partitioning: 0,
+        try_parse_hive_dates: true,
+        low_memory: false,
+        cache: true,
+        rechunk: false,
+        row_index_name: RawStr { data: ptr::null(), len: 0 },
+        row_index_offset: 0,
     };
     
     let context = ExecutionContext {
@@ -94,11 +107,7 @@ fn test_parquet_column_selection() {
     assert_ne!(result.polars_handle.handle, 0);
     
     // Clean up
-    if result.polars_handle.handle != 0 {
-        unsafe {
-            let _ = Box::from_raw(result.polars_handle.handle as *mut polars::prelude::DataFrame);
-        }
-    }
+    assert_eq!(release_dataframe(result.polars_handle.handle), 0);
 }
 
 #[test]
@@ -113,6 +122,14 @@ fn test_parquet_nonexistent_file() {
         n_rows: 0,
         parallel: true,
         with_glob: false,
+        use_statistics: true,
+        hive_partitioning: 0,
+        try_parse_hive_dates: true,
+        low_memory: false,
+        cache: true,
+        rechunk: false,
+        row_index_name: RawStr { data: ptr::null(), len: 0 },
+        row_index_offset: 0,
     };
     
     let context = ExecutionContext {
@@ -149,6 +166,14 @@ fn test_parquet_scan_args_optimization() {
         n_rows: 1, // Very small limit to test optimization
         parallel: false, // Test non-parallel path
         with_glob: false,
+        use_statistics: true,
+        hive_partitioning: 0,
+        try_parse_hive_dates: true,
+        low_memory: false,
+        cache: true,
+        rechunk: false,
+        row_index_name: RawStr { data: ptr::null(), len: 0 },
+        row_index_offset: 0,
     };
     
     let context = ExecutionContext {
@@ -163,13 +188,16 @@ fn test_parquet_scan_args_optimization() {
     assert_ne!(result.polars_handle.handle, 0);
     
     // Verify we got exactly 1 row (this tests the ScanArgsParquet.n_rows optimization)
-    if result.polars_handle.handle != 0 {
-        unsafe {
-            let df = &*(result.polars_handle.handle as *const polars::prelude::DataFrame);
-            assert_eq!(df.height(), 1);
-            
-            // Clean up
-            let _ = Box::from_raw(result.polars_handle.handle as *mut polars::prelude::DataFrame);
-        }
-    }
+    let no_args = ExecutionContext {
+        expr_stack: ptr::null_mut(),
+        operation_args: 0,
+    };
+    let collected = dispatch_collect(result.polars_handle, &no_args);
+    assert_eq!(collected.error_code, 0);
+    assert_eq!(dataframe_height(collected.polars_handle.handle), 1);
+
+    // Clean up - the scan and the collected frame are separate handles
+    assert_eq!(release_dataframe(collected.polars_handle.handle), 0);
+    assert_eq!(release_dataframe(result.polars_handle.handle), 0);
+    assert_ne!(release_dataframe(result.polars_handle.handle), 0); // Double release is rejected
 }
@@ -0,0 +1,35 @@
+#!/bin/bash
+set -e
+
+# Record or compare native benchmark baselines
+#   scripts/bench.sh record   - write benchmarks/baseline/<os>_<arch>.txt
+#   scripts/bench.sh compare  - run again and diff against the baseline with benchstat
+
+MODE="${1:-compare}"
+COUNT="${BENCH_COUNT:-10}"
+BASELINE="benchmarks/baseline/$(go env GOOS)_$(go env GOARCH).txt"
+
+run_benchmarks() {
+    go test ./benchmarks -run '^$' -bench . -benchmem -count="${COUNT}"
+}
+
+case "${MODE}" in
+    record)
+        mkdir -p "$(dirname "${BASELINE}")"
+        run_benchmarks | tee "${BASELINE}"
+        echo "📊 Baseline written to: ${BASELINE}"
+        ;;
+    compare)
+        if [[ ! -f "${BASELINE}" ]]; then
+            echo "❌ No baseline at ${BASELINE} - run: scripts/bench.sh record"
+            exit 1
+        fi
+        CURRENT="$(mktemp)"
+        run_benchmarks | tee "${CURRENT}"
+        go run golang.org/x/perf/cmd/benchstat@latest "${BASELINE}" "${CURRENT}"
+        ;;
+    *)
+        echo "usage: scripts/bench.sh [record|compare]"
+        exit 1
+        ;;
+esac